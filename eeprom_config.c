@@ -140,6 +140,121 @@ bool eeprom_save_schedule(const ProtoState *st)
     return true;
 }
 
+uint32_t eeprom_boot_count_increment(void)
+{
+    if (!eeprom_initialized) return 0;
+    uint32_t count;
+    EEPROMRead(&count, EEPROM_ADDR_BOOT_COUNT, sizeof(count));
+    if (count == 0xFFFFFFFFu) count = 0;   // never written
+    count++;
+    EEPROMProgram(&count, EEPROM_ADDR_BOOT_COUNT, sizeof(count));
+    return count;
+}
+
+bool eeprom_save_schedule_entries(const ProtoState *st, uint32_t first, uint32_t count)
+{
+    if (!eeprom_initialized || !st || first > 8 || count > 8 - first) return false;
+
+    uint32_t magic;
+    EEPROMRead(&magic, EEPROM_ADDR_SCHEDULE, sizeof(magic));
+    if (magic != EEPROM_MAGIC_SCHEDULE) return eeprom_save_schedule(st);
+
+    const uint32_t len_addr = EEPROM_ADDR_SCHEDULE + offsetof(eeprom_schedule_t, sched_len);
+    uint32_t stored_len;
+    EEPROMRead(&stored_len, len_addr, sizeof(stored_len));
+    uint32_t len = st->sched_len;
+
+    // Shrinking (delete): cut the stored list at 'first' while the later
+    // slots are rewritten, so they are never covered half-shifted
+    uint32_t cut = first;
+    if (len < stored_len) EEPROMProgram(&cut, len_addr, sizeof(cut));
+
+    uint32_t words[8];
+    for (uint32_t i = 0; i < count; i++) {
+        eeprom_schedule_t e;
+        e.sched[0].hh = st->sched[first + i].hh;
+        e.sched[0].mm = st->sched[first + i].mm;
+        e.sched[0].amount = st->sched[first + i].amount;
+        e.sched[0].en = 1; // Always store as enabled; flag removed from protocol
+        memcpy(&words[i], &e.sched[0], sizeof(words[i]));
+    }
+    if (count) {
+        EEPROMProgram(words, EEPROM_ADDR_SCHEDULE + offsetof(eeprom_schedule_t, sched) +
+                      first * sizeof(words[0]), count * sizeof(words[0]));
+    }
+    // Final count: when growing, only now that the new entries are in place
+    if (len > stored_len || (len < stored_len && len != cut)) EEPROMProgram(&len, len_addr, sizeof(len));
+    return true;
+}
+
+// History head/count, cached after the first access
+static bool hist_loaded = false;
+static uint8_t hist_head = 0;
+static uint8_t hist_count = 0;
+
+#define HISTORY_ADDR_INDEX  (EEPROM_ADDR_HISTORY + offsetof(eeprom_history_t, head))
+#define HISTORY_ADDR_REC(i) (EEPROM_ADDR_HISTORY + offsetof(eeprom_history_t, rec) + \
+                             (i) * sizeof(eeprom_meal_t))
+
+static void history_load_index(void)
+{
+    if (hist_loaded) return;
+    uint32_t hdr[2];
+    EEPROMRead(hdr, EEPROM_ADDR_HISTORY, sizeof(hdr));
+    uint8_t head = (uint8_t)(hdr[1] & 0xFFu);
+    uint8_t count = (uint8_t)((hdr[1] >> 8) & 0xFFu);
+    if (hdr[0] == EEPROM_MAGIC_HISTORY && head < EEPROM_HISTORY_RECORDS &&
+        count <= EEPROM_HISTORY_RECORDS) {
+        hist_head = head;
+        hist_count = count;
+    } else {
+        // Blank or foreign data: start an empty ring
+        uint32_t fresh[2] = { EEPROM_MAGIC_HISTORY, 0 };
+        EEPROMProgram(fresh, EEPROM_ADDR_HISTORY, sizeof(fresh));
+        hist_head = 0;
+        hist_count = 0;
+    }
+    hist_loaded = true;
+}
+
+bool eeprom_history_append(const eeprom_meal_t *rec)
+{
+    if (!eeprom_initialized || !rec) return false;
+    history_load_index();
+
+    // Record first, then the index, so a reset in between loses only the
+    // new record
+    uint32_t words[2];
+    memcpy(words, rec, sizeof(words));
+    EEPROMProgram(words, HISTORY_ADDR_REC(hist_head), sizeof(words));
+
+    hist_head = (uint8_t)((hist_head + 1u) % EEPROM_HISTORY_RECORDS);
+    if (hist_count < EEPROM_HISTORY_RECORDS) hist_count++;
+    uint32_t index = (uint32_t)hist_head | ((uint32_t)hist_count << 8);
+    EEPROMProgram(&index, HISTORY_ADDR_INDEX, sizeof(index));
+    return true;
+}
+
+uint32_t eeprom_history_count(void)
+{
+    if (!eeprom_initialized) return 0;
+    history_load_index();
+    return hist_count;
+}
+
+bool eeprom_history_get(uint32_t age, eeprom_meal_t *out)
+{
+    if (!eeprom_initialized || !out) return false;
+    history_load_index();
+    if (age >= hist_count) return false;
+
+    uint32_t slot = (hist_head + EEPROM_HISTORY_RECORDS - 1u - age) % EEPROM_HISTORY_RECORDS;
+    uint32_t words[2];
+    EEPROMRead(words, HISTORY_ADDR_REC(slot), sizeof(words));
+    memcpy(out, words, sizeof(*out));
+    return true;
+}
+
 // ... [Keep eeprom_format and eeprom_check_integrity] ...
 bool eeprom_format(void) { return true; /* stub */ }
 bool eeprom_check_integrity(void) { return true; /* stub */ }
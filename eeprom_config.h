@@ -14,8 +14,9 @@ typedef struct ProtoState_t ProtoState;
 
 #define EEPROM_ADDR_CALIBRATION     0x0000  // HX711 calibration data (28 bytes)
 #define EEPROM_ADDR_SCHEDULE        0x001C  // Feeding schedule (40 bytes)
-#define EEPROM_ADDR_HISTORY         0x0044  // History records (64 bytes, reserved)
-#define EEPROM_ADDR_FUTURE          0x0084  // Future expansion
+#define EEPROM_ADDR_HISTORY         0x0044  // Meal history ring (64 bytes)
+#define EEPROM_ADDR_BOOT_COUNT      0x0084  // Boot counter (4 bytes)
+#define EEPROM_ADDR_FUTURE          0x0088  // Future expansion
 
 // ============================================================================
 // Magic Numbers
@@ -23,6 +24,9 @@ typedef struct ProtoState_t ProtoState;
 
 #define EEPROM_MAGIC_CALIBRATION    0x48583731  // "HX71"
 #define EEPROM_MAGIC_SCHEDULE       0x53434844  // "SCHD"
+#define EEPROM_MAGIC_HISTORY        0x4D45414C  // "MEAL"
+
+#define EEPROM_HISTORY_RECORDS      7
 
 // ============================================================================
 // Data Structures
@@ -52,6 +56,23 @@ typedef struct {
     uint32_t crc32;           // CRC32 checksum
 } eeprom_schedule_t;
 
+// Meal history record (8 bytes)
+typedef struct {
+    uint32_t start_unix;      // Session start (local time), 0 if unsynced
+    uint16_t duration_s;      // Session length in seconds
+    uint16_t grams;           // Grams eaten
+} eeprom_meal_t;
+
+// Meal history ring (64 bytes). Appends program one record and then the
+// head/count word, never the whole block.
+typedef struct {
+    uint32_t magic;           // Magic number: 0x4D45414C "MEAL"
+    uint8_t head;             // Next slot to write (0-6)
+    uint8_t count;            // Valid records (0-7)
+    uint16_t reserved;        // Reserved for alignment (must be 0)
+    eeprom_meal_t rec[EEPROM_HISTORY_RECORDS];
+} eeprom_history_t;
+
 // ============================================================================
 // API Functions
 // ============================================================================
@@ -100,6 +121,54 @@ bool eeprom_load_schedule(ProtoState *st);
  */
 bool eeprom_save_schedule(const ProtoState *st);
 
+/**
+ * Increment the persistent boot counter (erased EEPROM counts as 0)
+ *
+ * @return the new count, including this boot; 0 if EEPROM is unavailable
+ */
+uint32_t eeprom_boot_count_increment(void);
+
+/**
+ * Save part of the feeding schedule: entries [first, first+count) and the
+ * entry count. Falls back to a full save if no schedule has been stored yet.
+ *
+ * Write order, so a reset part way never leaves a duplicated or half-
+ * shifted entry under the stored count (entries past it are ignored):
+ * - count shrinks (delete): the count is cut to 'first', the entries are
+ *   written, then the final count
+ * - count grows (add): the entries, then the count
+ * - count unchanged (set): the entries only
+ * A torn delete therefore loads as the entries before 'first'.
+ *
+ * @param st    Pointer to ProtoState structure containing schedule arrays
+ * @param first Index of the first entry to write (0-8)
+ * @param count Number of entries to write (may be 0 to update the count only)
+ * @return true if save successful, false otherwise
+ */
+bool eeprom_save_schedule_entries(const ProtoState *st, uint32_t first, uint32_t count);
+
+/**
+ * Append a meal record to the history ring, overwriting the oldest when full
+ *
+ * @param rec Record to append
+ * @return true if write successful, false otherwise
+ */
+bool eeprom_history_append(const eeprom_meal_t *rec);
+
+/**
+ * Number of valid records in the history ring (0-7)
+ */
+uint32_t eeprom_history_count(void);
+
+/**
+ * Read a meal record from the history ring
+ *
+ * @param age Record age, 0 = newest
+ * @param out Pointer to record to fill
+ * @return true if the record exists, false otherwise
+ */
+bool eeprom_history_get(uint32_t age, eeprom_meal_t *out);
+
 /**
  * Format EEPROM by erasing all configuration data
  * This will reset all stored data to defaults
@@ -4,9 +4,9 @@
 #include "inc/hw_memmap.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/gpio.h"
+#include "tick.h"
 
 extern uint32_t SystemCoreClock; // Provided by system_TM4C123.c
-extern uint32_t millis(void);    // Provided by main.c (SysTick counter)
 
 // crude busy-wait delay in microseconds
 static void delay_us(uint32_t us)
@@ -75,9 +75,9 @@ int hx711_data_ready(const hx711_t *dev)
 // Wait for HX711 ready with timeout (returns 1 on success, 0 on timeout)
 static int hx711_wait_ready_timeout(hx711_t *dev, uint32_t timeout_ms)
 {
-    uint32_t start = millis();
+    deadline_t timeout = deadline_in_ms(timeout_ms);
     while (!hx711_data_ready(dev)) {
-        if ((millis() - start) >= timeout_ms) {
+        if (deadline_expired(timeout)) {
             return 0; // timeout
         }
         delay_us(5);
@@ -0,0 +1,56 @@
+#include "jitter.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static jitter_stats_t g_jit[JIT_SITE_COUNT];
+
+static const char *const g_jit_names[JIT_SITE_COUNT] = {
+    [JIT_STEP_LATE]     = "STEP_LATE",
+    [JIT_TICK_DISPATCH] = "TICK_DISPATCH",
+    [JIT_UART_RX_ISR]   = "UART_RX_ISR",
+};
+
+void jitter_record(jitter_site_t site, uint32_t us)
+{
+    if ((unsigned)site >= JIT_SITE_COUNT) return;
+    jitter_stats_t *j = &g_jit[site];
+    uint32_t b = us ? (32u - (uint32_t)__builtin_clz(us)) : 0u;
+    if (b >= JITTER_BUCKETS) b = JITTER_BUCKETS - 1u;
+    j->hist[b]++;
+    j->count++;
+    j->sum_us += us;
+    if (us > j->max_us) j->max_us = us;
+}
+
+bool jitter_get(jitter_site_t site, jitter_stats_t *out)
+{
+    if (!out || (unsigned)site >= JIT_SITE_COUNT) return false;
+    *out = g_jit[site];
+    return true;
+}
+
+const char *jitter_site_name(jitter_site_t site)
+{
+    return ((unsigned)site < JIT_SITE_COUNT) ? g_jit_names[site] : "?";
+}
+
+int jitter_format(jitter_site_t site, char *buf, size_t len)
+{
+    jitter_stats_t j;
+    if (!jitter_get(site, &j)) return snprintf(buf, len, "?");
+    int n = snprintf(buf, len, "%s,%lu,%lu,%lu,", jitter_site_name(site),
+                     (unsigned long)j.count, (unsigned long)j.max_us,
+                     (unsigned long)(j.count ? j.sum_us / j.count : 0u));
+    for (int b = 0; b < JITTER_BUCKETS && n >= 0; b++) {
+        size_t off = ((size_t)n < len) ? (size_t)n : len;
+        n += snprintf(buf + off, len - off, "%s%lu", b ? "/" : "",
+                      (unsigned long)j.hist[b]);
+    }
+    return n;
+}
+
+void jitter_reset(void)
+{
+    memset(g_jit, 0, sizeof(g_jit));
+}
@@ -0,0 +1,39 @@
+#ifndef USER_JITTER_H
+#define USER_JITTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Real-time lateness histograms in microseconds.
+// Bucket 0 is < 1 us; bucket k (1..14) is [2^(k-1), 2^k) us; bucket 15 is
+// >= 16384 us. Recording is a count-leading-zeros and three adds, so it is
+// cheap enough for ISRs and is always compiled in.
+
+#define JITTER_BUCKETS 16
+
+typedef enum {
+    JIT_STEP_LATE = 0,   // feed half-step issue time vs. its timer expiry
+    JIT_TICK_DISPATCH,   // SysTick release -> start of a periodic task
+    JIT_UART_RX_ISR,     // UART RX interrupt service time
+    JIT_SITE_COUNT
+} jitter_site_t;
+
+typedef struct {
+    uint32_t count;
+    uint32_t max_us;
+    uint64_t sum_us;
+    uint32_t hist[JITTER_BUCKETS];
+} jitter_stats_t;
+
+void jitter_record(jitter_site_t site, uint32_t us);
+bool jitter_get(jitter_site_t site, jitter_stats_t *out);
+const char *jitter_site_name(jitter_site_t site);
+
+// Format one site as "SITE,count,max_us,mean_us,h0/h1/../h15", the +JIT
+// reply body shared by AT+JITTER and the host simulator. Returns the
+// snprintf-style length.
+int jitter_format(jitter_site_t site, char *buf, size_t len);
+void jitter_reset(void);
+
+#endif // USER_JITTER_H
@@ -10,40 +10,54 @@
 
 #include "uart.h"
 #include "proto.h"
+#include "tick.h"
+#include "task.h"
+#include "swtimer.h"
+#include "perf.h"
 
-static volatile uint32_t g_ms_ticks = 0;
-static volatile uint8_t g_flag_10ms = 0;
-static volatile uint8_t g_flag_100ms = 0;
-static volatile uint8_t g_flag_1000ms = 0;
+// Task ids double as priorities (0 runs first)
+enum {
+    TASK_TIMER = 0,     // swtimer_run: feed stepping and other timeouts
+    TASK_UART,          // Proto_Poll: AT command lines and +EVT output
+                        // (released by the RX ISR and by queued events)
+    TASK_SENSORS,       // Proto_Tick100ms: HX711 sampling/filtering
+    TASK_SCHEDULE,      // Proto_Tick1000ms: schedule checks
+};
 
 void SysTickIntHandler(void)
 {
-    g_ms_ticks++;
-    if ((g_ms_ticks % 10u) == 0u)   g_flag_10ms = 1;
-    if ((g_ms_ticks % 100u) == 0u)  g_flag_100ms = 1;
-    if ((g_ms_ticks % 1000u) == 0u) g_flag_1000ms = 1;
+    tick_isr();
+    task_tick_isr();
+    if (swtimer_tick_isr()) task_post(TASK_TIMER);
 }
 
-uint32_t millis(void)
+static void timer_kick(void)
 {
-    return g_ms_ticks;
+    task_post(TASK_TIMER);
+}
+
+static void uart_notify(void)
+{
+    task_post(TASK_UART);
 }
 
 int main(void)
 {
     // System clock 50 MHz using PLL (16MHz crystal)
     SysCtlClockSet(SYSCTL_SYSDIV_4 | SYSCTL_USE_PLL | SYSCTL_OSC_MAIN | SYSCTL_XTAL_16MHZ);
+    perf_init();
 
     // Init UART0 console at 115200 (PC or ESP32)
-    UART0_ConsoleInit(115200);
+    UART0_ConsoleInit(UART_LINK_DEFAULT_BAUD);
 
     // Systick @1kHz
-    SysTickPeriodSet(SysCtlClockGet() / 1000);
+    tick_init();
     SysTickIntRegister(SysTickIntHandler);
     SysTickIntEnable();
     SysTickEnable();
     IntMasterEnable();
 
+    swtimer_service_init(timer_kick);
     Proto_Init();
 
     // Initialize stepper outputs and run a brief self-test to verify wiring
@@ -55,11 +69,19 @@ int main(void)
     stepper_uln2003_rotate_steps(16, +1, 30);
     stepper_uln2003_rotate_steps(16, -1, 30);
 
-    // Main loop: poll UART for JSON lines and dispatch
+    // Tasks are registered after the blocking self-test so it is not
+    // counted as missed releases
+    task_create("TIMER", swtimer_run,      TASK_TIMER,    0u,    2u);
+    task_create("UART",  Proto_Poll,       TASK_UART,     0u,    10u);
+    task_create("SENSE", Proto_Tick100ms,  TASK_SENSORS,  100u,  0u);
+    task_create("SCHED", Proto_Tick1000ms, TASK_SCHEDULE, 1000u, 0u);
+    UART0_SetRxCallback(uart_notify);
+    Proto_SetEventCallback(uart_notify);
+    task_post(TASK_TIMER);  // catch up on timers armed during init
+    task_post(TASK_UART);   // drain anything received during init
+
+    // Main loop: run ready tasks in priority order
     while (1) {
-        Proto_Poll();
-        if (g_flag_10ms) { g_flag_10ms = 0; Proto_Tick10ms(); }
-        if (g_flag_100ms) { g_flag_100ms = 0; Proto_Tick100ms(); }
-        if (g_flag_1000ms) { g_flag_1000ms = 0; Proto_Tick1000ms(); }
+        task_run_next();
     }
 }
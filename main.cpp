@@ -5,12 +5,19 @@
 #include <TFT_eSPI.h>
 #include <Preferences.h>
 #include "qrcode.h"
-#include <ArduinoJson.h>
 #include <time.h>
 #include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <type_traits>
 #include <algorithm>
 #include <ctype.h>
+#include <stdarg.h>
 #include <stdlib.h>
+#include "driver/uart.h"
+#include "esp_heap_caps.h"
+#include "web_assets.h"  // generated from web/ by tools/gen_web_assets.py
 
 // ---------- Config ----------
 static const char *AP_SSID = "ESP32_SETUP";
@@ -20,7 +27,26 @@ static const IPAddress AP_GATEWAY(192, 168, 4, 1);
 static const IPAddress AP_NETMASK(255, 255, 255, 0);
 static const int UART_RX_PIN = 25;  // ESP32 -> TM4C UART0_TX
 static const int UART_TX_PIN = 26;  // ESP32 <- TM4C UART0_RX
-static const uint32_t UART_BAUD = 115200;
+static const uint32_t UART_BAUD = 115200;     // power-on and fallback rate
+static const uint32_t UART_FAST_BAUD = 921600; // negotiated with AT+BAUD
+constexpr uint8_t LINK_TIMEOUT_FALLBACK = 3;   // consecutive timeouts before dropping to UART_BAUD
+constexpr uint32_t BAUD_RETRY_MS = 60000;
+constexpr uint32_t STATUS_FULL_POLL_MS = 30000;  // full AT+STATUS at least this often (time drift check)
+// Software flow control: the TM4C sends XOFF/XON on its RX ring watermarks
+// and the ESP32 UART hardware pauses TX accordingly. Our own XOFF/XON are
+// sent on these RX FIFO levels (bytes).
+static const uart_port_t TM4C_UART_NUM = UART_NUM_1;
+static const uint8_t UART_XON_THRESH = 32;
+static const uint8_t UART_XOFF_THRESH = 96;
+static const char FLOW_XON = 0x11;
+static const char FLOW_XOFF = 0x13;
+// Link task (sole owner of Serial1)
+constexpr uint32_t LINK_TASK_STACK = 8192;
+constexpr UBaseType_t LINK_TASK_PRIO = 2;
+constexpr uint32_t LINK_RX_WAIT_MS = 20;     // longest sleep between RX checks while waiting for a reply
+constexpr uint32_t LINK_IDLE_WAIT_MS = 100;  // idle wake-up to poll for unsolicited lines
+constexpr uint32_t LINK_CALL_TIMEOUT_MS = 2500;
+constexpr uint32_t SET_TIME_CALL_TIMEOUT_MS = 1000;  // /api/set_time waits this long for the link
 
 // ---------- Display ----------
 TFT_eSPI tft = TFT_eSPI();
@@ -43,16 +69,20 @@ struct QRSet {
     QRCode qr;
     uint8_t buffer[QR_BUF_SIZE];
     String payload;
+    uint32_t gen = 0;  // bumped whenever the modules change; 0 = not made yet
 };
 
 QRSet qrJoinAp;
 QRSet qrConfigPage;
 QRSet qrMainPage;
 
+// Only a new payload re-encodes (and later re-rasterises) the code
 void makeQr(QRSet &out, const String &payload) {
+    if (out.gen && out.payload == payload) return;
     out.payload = payload;
     memset(out.buffer, 0, sizeof(out.buffer));
     qrcode_initText(&out.qr, out.buffer, QR_VERSION, ECC_MEDIUM, out.payload.c_str());
+    out.gen++;
 }
 
 // ---------- State ----------
@@ -71,8 +101,230 @@ std::vector<String> cachedSsids;
 bool scanInProgress = false;
 bool scanRequested = false;
 
+// Schedule upload benchmark (/api/link_bench): old paced writes vs line rate.
+// linkBench is written by the link task and read by the web handler, so
+// both sides go through CacheLock.
+constexpr uint8_t LINK_BENCH_ROUNDS = 3;
+constexpr uint8_t LINK_BENCH_PACE_MS = 2;  // former slowSend per-character delay
+constexpr uint8_t LINK_BENCH_RTT_ROUNDS = 20;
+constexpr uint8_t LINK_BENCH_BULK_ROUNDS = 5;
+constexpr size_t LINK_BENCH_BULK_BYTES = 200;  // fits the TM4C 256-byte line buffer
+struct LinkEchoResult {
+    uint32_t baud = 0;
+    bool ok = false;
+    uint32_t rttUs = 0;        // short AT+ECHO round trip, average
+    uint32_t bytesPerSec = 0;  // bulk AT+ECHO, both directions
+};
+struct LinkBench {
+    bool requested = false;
+    bool running = false;
+    bool valid = false;
+    uint32_t bytes = 0;
+    uint32_t pacedTotalMs = 0;
+    uint32_t pacedMaxMs = 0;
+    uint8_t pacedOk = 0;
+    uint32_t lineTotalMs = 0;
+    uint32_t lineMaxMs = 0;
+    uint8_t lineOk = 0;
+    LinkEchoResult echo[2];    // at UART_BAUD and UART_FAST_BAUD
+};
+LinkBench linkBench;
+
 AsyncWebServer server(80);
-HardwareSerial &tm4cSerial = Serial1;
+
+// ---------- JSON output ----------
+// Responses are serialised straight into the AsyncResponseStream (or a
+// fixed stack buffer for push messages) instead of being concatenated
+// into temporary Strings. Commas between members are inserted
+// automatically.
+class JsonWriter {
+public:
+    explicit JsonWriter(Print &out) : out_(out) {}
+
+    void beginObject() { open('{'); }
+    void endObject() { close('}'); }
+    void beginArray() { open('['); }
+    void endArray() { close(']'); }
+
+    // Member name; the next value (or begin*) belongs to it
+    void key(const char *k) {
+        separator();
+        string(k);
+        out_.write(':');
+        afterKey_ = true;
+    }
+
+    void value(const char *v) { separator(); string(v); }
+    void value(const String &v) { value(v.c_str()); }
+    void value(bool v) { separator(); out_.print(v ? "true" : "false"); }
+    // Any integer type up to 32 bits
+    template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value,
+                                                  int>::type = 0>
+    void value(T v) {
+        separator();
+        const bool negative = std::is_signed<T>::value && v < 0;
+        number(negative, negative ? 0u - static_cast<uint32_t>(v) : static_cast<uint32_t>(v));
+    }
+
+    template <typename T>
+    void member(const char *k, const T &v) {
+        key(k);
+        value(v);
+    }
+
+private:
+    static constexpr uint8_t MAX_DEPTH = 8;
+
+    void open(char c) {
+        separator();
+        out_.write(c);
+        if (depth_ < MAX_DEPTH) first_[depth_] = true;
+        depth_++;
+    }
+    void close(char c) {
+        if (depth_) depth_--;
+        out_.write(c);
+    }
+    void separator() {
+        if (afterKey_) {
+            afterKey_ = false;
+            return;
+        }
+        if (depth_ && depth_ <= MAX_DEPTH) {
+            if (!first_[depth_ - 1]) out_.write(',');
+            first_[depth_ - 1] = false;
+        }
+    }
+    void number(bool negative, uint32_t v) {
+        char buf[11];
+        size_t n = 0;
+        do {
+            buf[n++] = static_cast<char>('0' + v % 10);
+            v /= 10;
+        } while (v);
+        if (negative) out_.write('-');
+        while (n) out_.write(static_cast<uint8_t>(buf[--n]));
+    }
+    // RFC 8259 escaping; bytes >= 0x80 (UTF-8 SSIDs) pass through
+    void string(const char *s) {
+        static const char HEX[] = "0123456789abcdef";
+        out_.write('"');
+        for (; *s; ++s) {
+            const uint8_t c = static_cast<uint8_t>(*s);
+            if (c == '"' || c == '\\') {
+                out_.write('\\');
+                out_.write(c);
+            } else if (c == '\n') {
+                out_.print("\\n");
+            } else if (c == '\r') {
+                out_.print("\\r");
+            } else if (c == '\t') {
+                out_.print("\\t");
+            } else if (c < 0x20) {
+                out_.print("\\u00");
+                out_.write(HEX[c >> 4]);
+                out_.write(HEX[c & 0x0F]);
+            } else {
+                out_.write(c);
+            }
+        }
+        out_.write('"');
+    }
+
+    Print &out_;
+    bool first_[MAX_DEPTH] = {};
+    uint8_t depth_ = 0;
+    bool afterKey_ = false;
+};
+
+// Print into a caller-owned buffer; output past the end is dropped and
+// flagged
+class FixedPrint : public Print {
+public:
+    FixedPrint(char *buf, size_t cap) : buf_(buf), cap_(cap) { buf_[0] = '\0'; }
+    size_t write(uint8_t c) override {
+        if (len_ + 1 >= cap_) {
+            overflow_ = true;
+            return 0;
+        }
+        buf_[len_++] = static_cast<char>(c);
+        buf_[len_] = '\0';
+        return 1;
+    }
+    using Print::write;
+    const char *c_str() const { return buf_; }
+    size_t length() const { return len_; }
+    bool overflow() const { return overflow_; }
+
+private:
+    char *buf_;
+    size_t cap_;
+    size_t len_ = 0;
+    bool overflow_ = false;
+};
+
+constexpr size_t PUSH_JSON_MAX = 512;  // largest push message (schedule, 8 items)
+
+// {"t":"<type>","d":<body>} for the push channel
+template <typename Fill>
+String pushMessage(const char *type, Fill fill) {
+    char buf[PUSH_JSON_MAX];
+    FixedPrint out(buf, sizeof(buf));
+    JsonWriter w(out);
+    w.beginObject();
+    w.member("t", type);
+    w.key("d");
+    fill(w);
+    w.endObject();
+    if (out.overflow()) Serial.printf("[WS] %s message truncated\n", type);
+    return String(out.c_str());
+}
+
+// ---------- Push channel (/ws) ----------
+// Status, schedule, schedule-task state and TM4C events are pushed to the
+// page over a WebSocket. Every client has its own bounded outbox that is
+// drained only while its AsyncWebSocket queue has room (canSend), so a
+// slow client falls behind alone. State topics keep only their newest
+// message; when an outbox is full its oldest message is dropped.
+constexpr size_t PUSH_OUTBOX_MAX = 8;
+enum class PushTopic : uint8_t { STATUS, SCHEDULE, TASK, EVENT };
+struct PushMsg {
+    PushTopic topic;
+    String text;
+};
+struct PushClient {
+    uint32_t id;
+    std::deque<PushMsg> outbox;
+    uint32_t dropped = 0;
+};
+AsyncWebSocket ws("/ws");
+SemaphoreHandle_t pushMutex = nullptr;
+std::vector<PushClient> pushClients;
+
+void pushTo(PushClient &c, PushTopic topic, const String &text) {
+    if (topic != PushTopic::EVENT) {
+        for (auto it = c.outbox.begin(); it != c.outbox.end(); ++it) {
+            if (it->topic == topic) {  // superseded
+                c.outbox.erase(it);
+                break;
+            }
+        }
+    }
+    if (c.outbox.size() >= PUSH_OUTBOX_MAX) {
+        c.outbox.pop_front();
+        c.dropped++;
+    }
+    c.outbox.push_back({topic, text});
+}
+
+// Queue a pushMessage() for every client
+void pushAll(PushTopic topic, const String &text) {
+    xSemaphoreTake(pushMutex, portMAX_DELAY);
+    for (auto &c : pushClients) pushTo(c, topic, text);
+    xSemaphoreGive(pushMutex);
+}
+HardwareSerial &tm4cSerial = Serial1;  // used by the link task only
+TaskHandle_t linkTaskHandle = nullptr;
 uint32_t lastStatusPollMs = 0;
 uint32_t lastSchedulePollMs = 0;
 DisplayMode lastDisplayMode = DisplayMode::QR;
@@ -82,14 +334,12 @@ uint32_t lastAutoSettimeMs = 0;
 bool timeDesyncWarning = false;
 constexpr uint32_t TIME_DRIFT_THRESHOLD_SEC = 120;      // allowed diff between device and ESP32 local time
 uint32_t lastNtpSyncMs = 0;
-String lastQrTimeShown;
-bool lastQrTimeWarn = false;
 
 // Button to cycle display pages (active LOW, internal pull-up)
 constexpr int DISPLAY_BTN_PIN = 15;  // default BOOT button; adjust if needed
 bool lastBtnState = true;
 unsigned long lastBtnMs = 0;
-bool displayDirty = false;
+volatile bool displayDirty = false;  // also set from the link task
 
 // ---------- Device data (updated via TM4C UART) ----------
 struct ScheduleItem {
@@ -97,7 +347,9 @@ struct ScheduleItem {
     String amount;
 };
 
-// Async schedule update task
+// Async schedule update task. Written by the POST handler (AsyncTCP), loop()
+// and the link task, so every access goes through CacheLock. The job
+// itself works on its own copy of the items.
 enum class ScheduleTaskState { IDLE, PENDING, PROCESSING, SUCCESS, FAILED };
 struct ScheduleTask {
     ScheduleTaskState state = ScheduleTaskState::IDLE;
@@ -108,12 +360,45 @@ struct ScheduleTask {
 };
 ScheduleTask scheduleTask;
 
+// TM4C alarm bits (ALARM= in AT+STATUS, +EVT: ALARM)
+constexpr int ALARM_WATER_LOW = 0x01;
+constexpr int ALARM_FOOD_SENSOR = 0x02;
+constexpr int ALARM_WATER_SENSOR = 0x04;
+// TM4C health bits (AT+STATUS2)
+constexpr int HEALTH_FOOD_SENSOR = 0x01;
+constexpr int HEALTH_WATER_SENSOR = 0x02;
+constexpr int HEALTH_TIME_SYNCED = 0x04;
+constexpr int HEALTH_EEPROM = 0x08;
+
 struct StatusData {
     int foodBowlG = 45;   // grams
     int waterBowlG = 120; // grams
+    int alarm = 0;        // ALARM_* bits
+    bool busy = false;    // feed in progress
+    bool pumpOn = false;  // from +EVT: PUMP only
+    int feedPct = 0;      // progress of the running feed (AT+STATUS2)
+    int health = 0;       // HEALTH_* bits (AT+STATUS2)
 };
 
 StatusData statusData;
+
+// Rarely changing TM4C state, filled by AT+SNAPSHOT
+struct DeviceInfo {
+    bool valid = false;
+    String fwVersion;
+    uint32_t bootCount = 0;
+    uint32_t linkBaud = 0;
+    String lastFedTime;
+    int lastFedAmount = 0;
+    String lastEatenTime;
+    int lastEatenAmount = 0;
+    uint32_t lastEatenDurationS = 0;
+    int32_t foodScaleX1000 = 0;
+    int32_t foodOffset = 0;
+    int32_t waterScaleX1000 = 0;
+    int32_t waterOffset = 0;
+};
+DeviceInfo deviceInfo;
 std::vector<ScheduleItem> scheduleData = {
         {"08:00", "M"},
         {"18:00", "H"}
@@ -121,9 +406,46 @@ std::vector<ScheduleItem> scheduleData = {
 
 int32_t timezoneOffsetSeconds = 0;  // default UTC
 
+// ---------- Cache shared with the HTTP handlers ----------
+// statusData, scheduleData and deviceInfo are refreshed over the UART on
+// the link task and read by the AsyncTCP task and by loop() (the display
+// draws from a DashView copy). cacheMutex guards all sides; UART round
+// trips work on a copy and only the final assignment happens under the
+// lock.
+SemaphoreHandle_t cacheMutex = nullptr;
+bool statusCached = false;           // statusData holds a TM4C reply
+uint32_t statusVersion = 0;          // bumped on every statusData/deviceInfo write
+uint32_t scheduleVersion = 0;        // bumped on every scheduleData write
+bool scheduleCached = false;
+uint32_t statusFetchedMs = 0;        // millis() of the last good refresh
+uint32_t scheduleFetchedMs = 0;
+volatile uint32_t lastWebPollMs = 0; // last page request for live data
+constexpr uint32_t STATUS_REFRESH_MS = 2000;
+constexpr uint32_t FEED_REFRESH_MS = 500;   // while a feed runs, for its progress
+constexpr uint32_t SCHEDULE_REFRESH_MS = 60000;
+constexpr uint32_t WEB_ACTIVE_MS = 30000;  // keep refreshing this long after a page request
+
+struct CacheLock {
+    CacheLock() { xSemaphoreTake(cacheMutex, portMAX_DELAY); }
+    ~CacheLock() { xSemaphoreGive(cacheMutex); }
+    CacheLock(const CacheLock &) = delete;
+    CacheLock &operator=(const CacheLock &) = delete;
+};
+
 // ---------- TM4C UART AT command client ----------
 struct Tm4cLink {
     String asyncBuf;
+    uint32_t baud = UART_BAUD;
+    int64_t schedVer = -1;  // TM4C schedule version (uint32) behind scheduleData, -1 = unknown
+    uint32_t statusGen = 0;      // TM4C state generation behind statusData
+    bool statusGenValid = false;
+    uint32_t lastFullStatusMs = 0;
+    uint8_t consecutiveTimeouts = 0;
+    uint32_t lastBaudAttemptMs = 0;
+    bool statusV2 = true;        // cleared if the TM4C firmware lacks AT+STATUS2
+    void (*betweenOps)() = nullptr;  // runs urgent queued work between multi-command steps
+    void (*queueTimeSync)() = nullptr;  // queues an AT+SETTIME job (linkBegin)
+    bool timeSyncQueued = false;        // one is queued or running; link task only
 
     static bool parseLocalTimeString(const String &ts, time_t &outLocalEpoch) {
         int year, mon, day, hh, mm, ss;
@@ -147,19 +469,78 @@ struct Tm4cLink {
         // Increase RX buffer to 512 bytes to prevent data loss
         tm4cSerial.setRxBufferSize(512);
         tm4cSerial.begin(UART_BAUD, SERIAL_8N1, UART_RX_PIN, UART_TX_PIN);
+        uart_set_sw_flow_ctrl(TM4C_UART_NUM, true, UART_XON_THRESH, UART_XOFF_THRESH);
+        // Wake the link task when bytes arrive instead of polling for them
+        tm4cSerial.onReceive([]() {
+            if (linkTaskHandle) xTaskNotifyGive(linkTaskHandle);
+        });
     }
 
-    void sendCurrentTime() {
-        time_t unixUtc = time(nullptr);
-        uint32_t unixLocal = static_cast<uint32_t>(unixUtc + timezoneOffsetSeconds);
-        tm4cSerial.printf("AT+SETTIME=%lu\r\n", static_cast<unsigned long>(unixLocal));
-        Serial.printf("[UART] -> AT+SETTIME=%lu (tz=%d)\n", static_cast<unsigned long>(unixLocal), timezoneOffsetSeconds);
+    // Sleep until RX activity, a newly queued job or at most 'ms'
+    static void waitRx(uint32_t ms) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(std::max<uint32_t>(1, std::min(ms, LINK_RX_WAIT_MS))));
+    }
+
+    // Push our local time to the TM4C. AT+SETTIME goes out as its own
+    // queued job through sendAtCommand, which reads its +OK; written here
+    // directly, that +OK would be taken as the reply to the next command.
+    void requestTimeSync() {
+        if (timeSyncQueued || !queueTimeSync) return;
+        timeSyncQueued = true;
+        queueTimeSync();
+    }
+
+    // "+EVT: <kind>,<args>" from the TM4C: update the caches right away and
+    // forward the event to connected browsers.
+    void handleEvent(const String &body) {
+        Serial.printf("[UART] <- +EVT: %s\n", body.c_str());
+        int c1 = body.indexOf(',');
+        String kind = c1 >= 0 ? body.substring(0, c1) : body;
+        String a = "", b = "", c = "";
+        if (c1 >= 0) {
+            int c2 = body.indexOf(',', c1 + 1);
+            a = body.substring(c1 + 1, c2 >= 0 ? c2 : body.length());
+            if (c2 >= 0) {
+                int c3 = body.indexOf(',', c2 + 1);
+                b = body.substring(c2 + 1, c3 >= 0 ? c3 : body.length());
+                if (c3 >= 0) c = body.substring(c3 + 1);
+            }
+        }
+        {
+            CacheLock lock;
+            statusVersion++;
+            if (kind == "FEED") {
+                if (a == "START") {
+                    statusData.busy = true;
+                } else if (a == "DONE") {
+                    statusData.busy = false;
+                    deviceInfo.lastFedAmount = b.toInt();
+                    deviceInfo.lastFedTime = c;
+                }
+            } else if (kind == "MEAL") {
+                deviceInfo.lastEatenAmount = a.toInt();
+                deviceInfo.lastEatenDurationS = strtoul(b.c_str(), nullptr, 10);
+                deviceInfo.lastEatenTime = c;
+            } else if (kind == "PUMP") {
+                statusData.pumpOn = a.toInt() != 0;
+            } else if (kind == "ALARM") {
+                statusData.alarm = a.toInt();
+            } else if (kind == "LOST") {
+                statusGenValid = false;  // events were dropped; next status poll is a full one
+            }
+        }
+        displayDirty = true;
+        pushAll(PushTopic::EVENT, pushMessage("evt", [&](JsonWriter &w) { w.value(body); }));
     }
 
     void handleAsyncLine(const String &line) {
-        if (line.startsWith("AT+GETTIME")) {
+        if (line.startsWith("+EVT:")) {
+            String body = line.substring(5);
+            body.trim();
+            handleEvent(body);
+        } else if (line.startsWith("AT+GETTIME")) {
             Serial.println("[UART] <- AT+GETTIME (async)");
-            sendCurrentTime();
+            requestTimeSync();
         } else if (line.length()) {
             Serial.printf("[UART] Async line ignored: %s\n", line.c_str());
         }
@@ -168,10 +549,10 @@ struct Tm4cLink {
     void poll() {
         while (tm4cSerial.available()) {
             char c = static_cast<char>(tm4cSerial.read());
-            if (c == '\r') continue;
+            if (c == '\r' || c == FLOW_XON || c == FLOW_XOFF) continue;
             if (c == '\n') {
                 if (asyncBuf.length()) {
-                    Serial.printf("[UART] <- %s\n", asyncBuf.c_str());
+                    if (!asyncBuf.startsWith("+EVT:")) Serial.printf("[UART] <- %s\n", asyncBuf.c_str());
                     handleAsyncLine(asyncBuf);
                     asyncBuf = "";
                 }
@@ -181,21 +562,28 @@ struct Tm4cLink {
         }
     }
 
-    bool sendAtCommand(const String &cmd, String &payload, String &err, uint32_t timeoutMs = 600, bool slowSend = false, uint8_t slowDelayMs = 2, uint8_t slowDelaySepMs = 4) {
-        while (tm4cSerial.available()) tm4cSerial.read();  // clear stale bytes
+    // paceMs > 0 reproduces the old per-character pacing (2x after ';');
+    // flow control makes it unnecessary and only /api/link_bench uses it.
+    // Lines starting with 'collectPrefix' before the final +OK are appended
+    // to 'collected' with the prefix stripped (multi-line replies).
+    bool sendAtCommand(const String &cmd, String &payload, String &err, uint32_t timeoutMs = 600, uint8_t paceMs = 0,
+                       const char *collectPrefix = nullptr, std::vector<String> *collected = nullptr) {
+        poll();  // handle queued events instead of discarding them
+        if (asyncBuf.length()) {
+            // A partial unsolicited line would prefix the reply; the TM4C
+            // only writes events between commands, so it is noise.
+            Serial.printf("[UART] dropping partial line: %s\n", asyncBuf.c_str());
+            asyncBuf = "";
+        }
         Serial.printf("[UART] -> %s\n", cmd.c_str());
         String wire = cmd;
         if (!wire.endsWith("\r\n")) wire += "\r\n";
 
-        if (slowSend) {
+        if (paceMs) {
             for (size_t i = 0; i < wire.length(); ++i) {
                 char c = wire.charAt(i);
                 tm4cSerial.write(static_cast<uint8_t>(c));
-                if (c == ';') {
-                    delay(slowDelaySepMs);  // brief pause between schedule entries
-                } else {
-                    delay(slowDelayMs);  // gentle pacing to avoid UART overruns
-                }
+                delay(c == ';' ? paceMs * 2 : paceMs);
             }
         } else {
             tm4cSerial.print(wire);
@@ -211,12 +599,17 @@ struct Tm4cLink {
         while (millis() - start < timeoutMs) {
             while (tm4cSerial.available()) {
                 char c = static_cast<char>(tm4cSerial.read());
-                if (c == '\r') continue;
+                if (c == '\r' || c == FLOW_XON || c == FLOW_XOFF) continue;
                 if (c == '\n') {
                     if (line.length() == 0) continue;
                     if (line.startsWith("AT+GETTIME")) {
                         Serial.println("[UART] <- AT+GETTIME (during wait)");
-                        sendCurrentTime();
+                        requestTimeSync();
+                        line = "";
+                        continue;
+                    }
+                    if (line.startsWith("+EVT:")) {
+                        handleAsyncLine(line);
                         line = "";
                         continue;
                     }
@@ -225,7 +618,15 @@ struct Tm4cLink {
                         line = "";
                         continue;
                     }
+                    if (collectPrefix && collected && line.startsWith(collectPrefix)) {
+                        String body = line.substring(strlen(collectPrefix));
+                        body.trim();
+                        collected->push_back(body);
+                        line = "";
+                        continue;
+                    }
                     if (line.startsWith("+OK")) {
+                        consecutiveTimeouts = 0;
                         int colon = line.indexOf(':');
                         payload = (colon >= 0) ? line.substring(colon + 1) : "";
                         payload.trim();
@@ -233,6 +634,7 @@ struct Tm4cLink {
                         return true;
                     }
                     if (line.startsWith("+ERR")) {
+                        consecutiveTimeouts = 0;
                         err = line.substring(line.indexOf(':') + 1);
                         err.trim();
                         if (err.length() == 0) err = "ERR";
@@ -246,16 +648,152 @@ struct Tm4cLink {
                     if (line.length() < 256) line += c;
                 }
             }
-            delay(2);  // yield to avoid starving watchdog while waiting
+            uint32_t elapsed = millis() - start;
+            if (elapsed < timeoutMs) waitRx(timeoutMs - elapsed);
         }
         err = "timeout";
+        // A reset TM4C is back at UART_BAUD; follow it after a few timeouts
+        if (++consecutiveTimeouts >= LINK_TIMEOUT_FALLBACK && baud != UART_BAUD) {
+            Serial.printf("[UART] %u timeouts at %lu baud, falling back to %lu\n",
+                          consecutiveTimeouts, static_cast<unsigned long>(baud), static_cast<unsigned long>(UART_BAUD));
+            setLocalBaud(UART_BAUD);
+            consecutiveTimeouts = 0;
+        }
+        return false;
+    }
+
+    void setLocalBaud(uint32_t rate) {
+        tm4cSerial.flush();  // finish sending at the old rate
+        tm4cSerial.updateBaudRate(rate);
+        baud = rate;
+    }
+
+    // AT+BAUD handshake: the TM4C acknowledges at the old rate and switches,
+    // we switch and send AT+BAUDOK at the new rate, then confirm with an
+    // echo round trip. On failure both sides end up back at UART_BAUD (the
+    // TM4C by its own confirm timeout or framing-error check).
+    bool negotiateBaud(uint32_t rate) {
+        lastBaudAttemptMs = millis();
+        if (rate == baud) return true;
+        uint32_t from = baud;
+        String payload, err;
+        if (!sendAtCommand("AT+BAUD=" + String(rate), payload, err)) {
+            Serial.printf("[UART] AT+BAUD=%lu refused: %s\n", static_cast<unsigned long>(rate), err.c_str());
+            return false;
+        }
+        setLocalBaud(rate);
+        String probe = "BAUD" + String(rate);
+        if (!sendAtCommand("AT+BAUDOK", payload, err) ||
+            !sendAtCommand("AT+ECHO=" + probe, payload, err) || payload != probe) {
+            Serial.printf("[UART] %lu baud not confirmed (%s), back to %lu\n", static_cast<unsigned long>(rate),
+                          err.length() ? err.c_str() : "echo mismatch", static_cast<unsigned long>(UART_BAUD));
+            setLocalBaud(UART_BAUD);
+            return false;
+        }
+        Serial.printf("[UART] link %lu -> %lu baud\n", static_cast<unsigned long>(from), static_cast<unsigned long>(rate));
+        return true;
+    }
+
+    // Raw AT+ECHO round trip without logging, for link benchmarks
+    bool echoRoundTrip(const String &probe, uint32_t timeoutMs = 200) {
+        poll();
+        asyncBuf = "";
+        tm4cSerial.print("AT+ECHO=" + probe + "\r\n");
+        String expect = "+OK: " + probe;
+        String line;
+        uint32_t start = millis();
+        while (millis() - start < timeoutMs) {
+            while (tm4cSerial.available()) {
+                char c = static_cast<char>(tm4cSerial.read());
+                if (c == '\r' || c == FLOW_XON || c == FLOW_XOFF) continue;
+                if (c == '\n') {
+                    if (line == expect) return true;
+                    if (line.startsWith("+EVT:")) handleAsyncLine(line);
+                    line = "";
+                } else if (line.length() < 256) {
+                    line += c;
+                }
+            }
+            uint32_t elapsed = millis() - start;
+            if (elapsed < timeoutMs) waitRx(timeoutMs - elapsed);
+        }
         return false;
     }
 
+    // 'out' must be the cache the generation refers to (statusData): with a
+    // current generation the TM4C replies SAME and 'out' is left as is.
     bool getStatus(StatusData &out, String &err) {
         String payload;
-        if (!sendAtCommand("AT+STATUS", payload, err)) return false;
-        // Expected: TIME=YYYY-MM-DD HH:MM:SS,BOWL=<g>,WATER=<g>,ALARM=<b>,BUSY=<b>
+        bool conditional = statusGenValid && millis() - lastFullStatusMs < STATUS_FULL_POLL_MS;
+        String cmd = statusV2 ? "AT+STATUS2" : "AT+STATUS";
+        if (conditional) cmd += "?" + String(statusGen);
+        if (!sendAtCommand(cmd, payload, err)) {
+            if (statusV2 && err == "UNKNOWN_CMD") {
+                Serial.println("[UART] AT+STATUS2 unsupported, using AT+STATUS");
+                statusV2 = false;
+                return getStatus(out, err);
+            }
+            return false;
+        }
+        if (payload == "SAME") return true;
+        if (!statusV2) {
+            applyStatus(payload, out);
+            return true;
+        }
+        if (!applyStatus2(payload.c_str(), out)) {
+            err = "bad status";
+            return false;
+        }
+        return true;
+    }
+
+    // "2,<gen>,<epoch>,<ms>,<bowl>,<water>,<alarm>,<busy>,<feed_pct>,<health>"
+    // Parsed in place with strtoll; fields appended by newer firmware are
+    // ignored.
+    bool applyStatus2(const char *p, StatusData &out) {
+        constexpr int FIELDS = 10;
+        long long f[FIELDS];
+        for (int i = 0; i < FIELDS; ++i) {
+            char *end;
+            f[i] = strtoll(p, &end, 10);
+            if (end == p) return false;
+            if (*end != ',' && !(i == FIELDS - 1 && *end == '\0')) return false;
+            p = end + 1;
+        }
+        if (f[0] != 2) return false;
+        lastFullStatusMs = millis();
+        statusGen = static_cast<uint32_t>(f[1]);
+        statusGenValid = true;
+        out.foodBowlG = static_cast<int>(f[4]);
+        out.waterBowlG = static_cast<int>(f[5]);
+        out.alarm = static_cast<int>(f[6]);
+        out.busy = f[7] != 0;
+        out.feedPct = static_cast<int>(f[8]);
+        out.health = static_cast<int>(f[9]);
+        checkDrift(static_cast<time_t>(f[2]), f[2] != 0);
+        return true;
+    }
+
+    // Device local epoch vs ours; resync the TM4C clock if it drifted
+    void checkDrift(time_t devLocal, bool valid) {
+        if (!valid) {
+            timeDesyncWarning = true;
+            return;
+        }
+        time_t nowLocal = time(nullptr) + timezoneOffsetSeconds;
+        long diff = labs((long) (nowLocal - devLocal));
+        if (diff > TIME_DRIFT_THRESHOLD_SEC) {
+            Serial.printf("[UART] Detected time drift %ld sec, resyncing...\n", diff);
+            requestTimeSync();
+        }
+        timeDesyncWarning = diff > TIME_DRIFT_THRESHOLD_SEC;
+        if (!timeDesyncWarning) lastAutoSettimeMs = millis();
+    }
+
+    void applyStatus(const String &payload, StatusData &out) {
+        lastFullStatusMs = millis();
+        statusGenValid = false;
+        // Expected: TIME=YYYY-MM-DD HH:MM:SS,BOWL=<g>,WATER=<g>,ALARM=<b>,BUSY=<b>,GEN=<n>
         int last = 0;
         String deviceTimeStr;
         while (true) {
@@ -270,54 +808,57 @@ struct Tm4cLink {
                 if (key == "TIME") deviceTimeStr = val;
                 if (key == "BOWL") out.foodBowlG = val.toInt();
                 if (key == "WATER") out.waterBowlG = val.toInt();
+                if (key == "ALARM") out.alarm = val.toInt();
+                if (key == "BUSY") out.busy = val.toInt() != 0;
+                if (key == "GEN") {
+                    statusGen = strtoul(val.c_str(), nullptr, 10);
+                    statusGenValid = true;
+                }
             }
             if (comma < 0) break;
             last = comma + 1;
         }
-        if (deviceTimeStr.length()) {
-            time_t devLocal, nowLocal;
-            if (parseLocalTimeString(deviceTimeStr, devLocal)) {
-                nowLocal = time(nullptr) + timezoneOffsetSeconds;
-                long diff = labs((long) (nowLocal - devLocal));
-                if (diff > TIME_DRIFT_THRESHOLD_SEC) {
-                    Serial.printf("[UART] Detected time drift %ld sec, resyncing...\n", diff);
-                    sendCurrentTime();
-                }
-                timeDesyncWarning = diff > TIME_DRIFT_THRESHOLD_SEC;
-                if (!timeDesyncWarning) lastAutoSettimeMs = millis();
-            } else {
-                timeDesyncWarning = true;
-            }
-        } else {
-            timeDesyncWarning = true;
-        }
-        return true;
+        time_t devLocal = 0;
+        bool valid = deviceTimeStr.length() && parseLocalTimeString(deviceTimeStr, devLocal);
+        checkDrift(devLocal, valid);
+    }
+
+    // 'L', 'M' or 'H' from the first letter of an amount, 0 if invalid
+    static char amountCode(const char *amt) {
+        const char c = static_cast<char>(toupper(static_cast<unsigned char>(amt[0])));
+        return (c == 'L' || c == 'M' || c == 'H') ? c : 0;
     }
 
     static String amountToCode(const String &amt) {
-        if (amt.length() == 0) return "";
-        char c = toupper(amt.charAt(0));
-        if (c == 'L' || c == 'M' || c == 'H') return String(c);
-        return "";
+        const char c = amountCode(amt.c_str());
+        return c ? String(c) : String();
     }
 
     bool getSchedule(std::vector<ScheduleItem> &out, String &err) {
         String payload;
         if (!sendAtCommand("AT+GETSCHED", payload, err)) return false;
+        applySchedule(payload, out);
+        return true;
+    }
+
+    void applySchedule(String payload, std::vector<ScheduleItem> &out) {
         out.clear();
         payload.trim();
-        if (payload.equalsIgnoreCase("NONE")) return true;
-        if (payload.length() == 0) return true;
+        schedVer = -1;
+        if (payload.equalsIgnoreCase("NONE")) return;
+        if (payload.length() == 0) return;
 
-        // New format: 0700M;1200L;1900H
+        // New format: V=<ver>;0700M;1200L;1900H (or V=<ver>;NONE)
         int last = 0;
         while (true) {
             int semi = payload.indexOf(';', last);
             String entry = (semi >= 0) ? payload.substring(last, semi) : payload.substring(last);
             entry.trim();
 
-            // Expected format: HHMM + L/M/H (e.g., "0700M", "1200L")
-            if (entry.length() >= 5) {
+            if (entry.startsWith("V=")) {
+                schedVer = parseSchedVer(entry.substring(2));
+            } else if (entry.length() >= 5) {
+                // Expected format: HHMM + L/M/H (e.g., "0700M", "1200L")
                 String timeStr = entry.substring(0, 4);  // HHMM
                 String amountCode = amountToCode(entry.substring(4));  // L/M/H
 
@@ -331,31 +872,203 @@ struct Tm4cLink {
             if (semi < 0) break;
             last = semi + 1;
         }
+    }
+
+    // Calls fn(key, value) for each "KEY=VALUE" in a comma separated list
+    template <typename Fn>
+    static void forEachField(const String &list, Fn fn) {
+        int last = 0;
+        while (true) {
+            int comma = list.indexOf(',', last);
+            String part = (comma >= 0) ? list.substring(last, comma) : list.substring(last);
+            int eq = part.indexOf('=');
+            if (eq > 0) {
+                String key = part.substring(0, eq);
+                String val = part.substring(eq + 1);
+                key.trim(); val.trim();
+                fn(key, val);
+            }
+            if (comma < 0) break;
+            last = comma + 1;
+        }
+    }
+
+    // AT+SNAPSHOT: status, schedule, meal log, calibration and firmware info
+    // in one exchange instead of a round trip each.
+    bool getSnapshot(StatusData &status, std::vector<ScheduleItem> &sched, DeviceInfo &info, String &err) {
+        std::vector<String> lines;
+        String payload;
+        if (!sendAtCommand("AT+SNAPSHOT", payload, err, 1000, 0, "+SNAP:", &lines)) return false;
+        bool gotStatus = false, gotSched = false;
+        for (const String &l : lines) {
+            int comma = l.indexOf(',');
+            if (comma < 0) continue;
+            String kind = l.substring(0, comma);
+            String body = l.substring(comma + 1);
+            if (kind == "STATUS") {
+                applyStatus(body, status);
+                gotStatus = true;
+            } else if (kind == "SCHED") {
+                applySchedule(body, sched);
+                gotSched = true;
+            } else if (kind == "FW") {
+                forEachField(body, [&](const String &k, const String &v) {
+                    if (k == "VER") info.fwVersion = v;
+                    if (k == "BOOT") info.bootCount = strtoul(v.c_str(), nullptr, 10);
+                    if (k == "BAUD") info.linkBaud = strtoul(v.c_str(), nullptr, 10);
+                });
+            } else if (kind == "LOG") {
+                forEachField(body, [&](const String &k, const String &v) {
+                    if (k == "FED_TIME") info.lastFedTime = v;
+                    if (k == "FED_AMT") info.lastFedAmount = v.toInt();
+                    if (k == "EAT_TIME") info.lastEatenTime = v;
+                    if (k == "EAT_AMT") info.lastEatenAmount = v.toInt();
+                    if (k == "EAT_DUR") info.lastEatenDurationS = strtoul(v.c_str(), nullptr, 10);
+                });
+            } else if (kind == "CAL") {
+                forEachField(body, [&](const String &k, const String &v) {
+                    if (k == "FOOD_SCALE_X1000") info.foodScaleX1000 = v.toInt();
+                    if (k == "FOOD_OFF") info.foodOffset = v.toInt();
+                    if (k == "WATER_SCALE_X1000") info.waterScaleX1000 = v.toInt();
+                    if (k == "WATER_OFF") info.waterOffset = v.toInt();
+                });
+            }
+        }
+        if (!gotStatus || !gotSched) {
+            err = "incomplete snapshot";
+            return false;
+        }
+        info.valid = true;
         return true;
     }
 
-    bool setSchedule(const std::vector<ScheduleItem> &items, String &err, bool extraSlow = false) {
+    // "HH:MM" + amount -> "HHMMA" (e.g. "0700M"), empty if the amount is invalid
+    static String entryCode(const ScheduleItem &item) {
+        const String code = amountToCode(item.amount);
+        if (code.length() == 0) return "";
+        String timeStr = item.time;
+        timeStr.replace(":", "");  // Remove colon: "07:00" -> "0700"
+        return timeStr + code;
+    }
+
+    static ScheduleItem itemFromCode(const String &code) {
+        return {code.substring(0, 2) + ":" + code.substring(2, 4), code.substring(4)};
+    }
+
+    static String scheduleWireString(const std::vector<ScheduleItem> &items) {
         String schedStr;
         for (size_t i = 0; i < items.size(); ++i) {
-            const String code = amountToCode(items[i].amount);
+            const String code = entryCode(items[i]);
             if (code.length() == 0) continue;
             if (schedStr.length()) schedStr += ";";
+            schedStr += code;
+        }
+        return "AT+SCHED=" + (schedStr.length() ? schedStr : String("NONE"));
+    }
 
-            // Convert HH:MM to HHMM format
-            String timeStr = items[i].time;
-            timeStr.replace(":", "");  // Remove colon: "07:00" -> "0700"
+    // Versions span the full uint32 range (boot count in the top half), so
+    // not toInt(), which is signed
+    static int64_t parseSchedVer(const String &s) {
+        char *end;
+        unsigned long v = strtoul(s.c_str(), &end, 10);
+        return (end != s.c_str() && *end == '\0') ? static_cast<int64_t>(v) : -1;
+    }
 
-            // New format: HHMM + L/M/H (e.g., "0700M")
-            schedStr += timeStr + code;
-        }
+    // "+OK: V=<ver>" reply to a schedule change
+    void noteSchedVer(const String &payload) {
+        schedVer = payload.startsWith("V=") ? parseSchedVer(payload.substring(2)) : -1;
+    }
+
+    bool setSchedule(const std::vector<ScheduleItem> &items, String &err, uint8_t paceMs = 0) {
+        String cmd = scheduleWireString(items);
         String payload;
-        if (schedStr.length() == 0) {
-            return sendAtCommand("AT+SCHED=NONE", payload, err);
+        uint32_t t0 = millis();
+        bool ok = sendAtCommand(cmd, payload, err, 3000, paceMs);
+        noteSchedVer(ok ? payload : String());
+        Serial.printf("[UART] schedule upload %u bytes in %lu ms (%s, %s)\n",
+                      static_cast<unsigned>(cmd.length() + 2), static_cast<unsigned long>(millis() - t0),
+                      paceMs ? "paced" : "line rate", ok ? "ok" : err.c_str());
+        return ok;
+    }
+
+    // Move the TM4C schedule from scheduleData to 'items' with the fewest
+    // indexed edits: entries are matched as a multiset, unmatched old slots
+    // are overwritten (SCHEDSET), leftovers deleted from the highest index
+    // down (SCHEDDEL) and the rest appended (SCHEDADD). Falls back to a full
+    // AT+SCHED when that is shorter, the version is unknown, or an edit is
+    // refused. 'device' receives the schedule in TM4C order.
+    bool updateSchedule(const std::vector<ScheduleItem> &items, std::vector<ScheduleItem> &device, String &err) {
+        std::vector<String> want, have;
+        for (const auto &it : items) {
+            String c = entryCode(it);
+            if (c.length()) want.push_back(c);
+        }
+        for (const auto &it : scheduleData) have.push_back(entryCode(it));
+
+        if (schedVer >= 0) {
+            std::vector<bool> kept(have.size(), false);
+            std::vector<String> adds;
+            for (const auto &w : want) {
+                size_t i = 0;
+                while (i < have.size() && (kept[i] || have[i] != w)) ++i;
+                if (i < have.size()) kept[i] = true;
+                else adds.push_back(w);
+            }
+            std::vector<size_t> dels;
+            for (size_t i = 0; i < have.size(); ++i) {
+                if (!kept[i]) dels.push_back(i);
+            }
+
+            struct Op { char kind; size_t idx; String code; };
+            std::vector<Op> ops;
+            size_t pairs = std::min(dels.size(), adds.size());
+            for (size_t k = 0; k < pairs; ++k) ops.push_back({'S', dels[k], adds[k]});
+            for (size_t k = dels.size(); k > pairs; --k) ops.push_back({'D', dels[k - 1], ""});
+            for (size_t k = pairs; k < adds.size(); ++k) ops.push_back({'A', 0, adds[k]});
+
+            if (ops.empty()) {
+                device = scheduleData;
+                return true;
+            }
+            auto opCommand = [](const Op &op, int64_t ver64) -> String {
+                String ver(static_cast<unsigned long>(ver64));
+                if (op.kind == 'S') return "AT+SCHEDSET=" + ver + "," + String(op.idx) + "," + op.code;
+                if (op.kind == 'D') return "AT+SCHEDDEL=" + ver + "," + String(op.idx);
+                return "AT+SCHEDADD=" + ver + "," + op.code;
+            };
+            size_t fullBytes = scheduleWireString(items).length() + 2;
+            size_t opBytes = 0;
+            for (const auto &op : ops) opBytes += opCommand(op, schedVer).length() + 2;
+            if (opBytes <= fullBytes) {
+                std::vector<String> dev = have;
+                bool ok = true;
+                uint32_t t0 = millis();
+                for (const auto &op : ops) {
+                    if (betweenOps) betweenOps();  // e.g. a feed request does not wait for the whole edit
+                    String payload;
+                    if (!sendAtCommand(opCommand(op, schedVer), payload, err)) { ok = false; break; }
+                    noteSchedVer(payload);
+                    if (op.kind == 'S') dev[op.idx] = op.code;
+                    else if (op.kind == 'D') dev.erase(dev.begin() + op.idx);
+                    else dev.push_back(op.code);
+                }
+                if (ok) {
+                    device.clear();
+                    for (const auto &c : dev) device.push_back(itemFromCode(c));
+                    Serial.printf("[UART] schedule diff: %u edits, %u bytes in %lu ms (full upload %u bytes)\n",
+                                  static_cast<unsigned>(ops.size()), static_cast<unsigned>(opBytes),
+                                  static_cast<unsigned long>(millis() - t0), static_cast<unsigned>(fullBytes));
+                    return true;
+                }
+                Serial.printf("[UART] schedule edit failed (%s), sending full schedule\n", err.c_str());
+                schedVer = -1;
+            }
         }
-        // Long schedule strings can overrun TM4C UART; send slowly with extra timeout.
-        uint8_t perCharDelay = extraSlow ? 6 : 2;
-        uint8_t perSemiDelay = extraSlow ? 12 : 4;
-        return sendAtCommand("AT+SCHED=" + schedStr, payload, err, 3000, true, perCharDelay, perSemiDelay);
+
+        if (!setSchedule(items, err)) return false;
+        device.clear();
+        for (const auto &c : want) device.push_back(itemFromCode(c));
+        return true;
     }
 
     bool feedNow(const String &level, String &err) {
@@ -376,14 +1089,211 @@ struct Tm4cLink {
 
 Tm4cLink tm4c;
 
-String scheduleToJson() {
-    String json = "[";
-    for (size_t i = 0; i < scheduleData.size(); ++i) {
-        if (i) json += ",";
-        json += "{\"time\":\"" + scheduleData[i].time + "\",\"amount\":\"" + scheduleData[i].amount + "\"}";
+// ---------- Link task ----------
+// Every TM4C exchange runs on one FreeRTOS task that owns Serial1. Callers
+// queue a job with a priority: URGENT (feed) runs first and also between
+// the steps of a schedule edit, NORMAL for settings/schedule uploads,
+// BACKGROUND for cache refreshes and benchmarks. A caller either waits on the job's
+// completion (linkCall) or passes a callback, which runs on the link task.
+enum class LinkPrio : uint8_t { URGENT = 0, NORMAL, BACKGROUND, COUNT };
+
+struct LinkJob {
+    const char *name = "";
+    std::function<bool(String &err)> run;                   // on the link task
+    std::function<void(bool ok, const String &err)> done;  // optional, on the link task
+    SemaphoreHandle_t doneSem = nullptr;                   // optional, given when finished
+    bool started = false;    // under linkQueueMutex: run() has been entered
+    bool cancelled = false;  // under linkQueueMutex: skip run(), the caller gave up
+    bool ok = false;
+    String err;
+
+    ~LinkJob() {
+        if (doneSem) vSemaphoreDelete(doneSem);
+    }
+};
+using LinkJobPtr = std::shared_ptr<LinkJob>;
+
+SemaphoreHandle_t linkQueueMutex = nullptr;
+std::deque<LinkJobPtr> linkQueues[static_cast<size_t>(LinkPrio::COUNT)];
+
+void linkEnqueue(LinkPrio prio, const LinkJobPtr &job) {
+    xSemaphoreTake(linkQueueMutex, portMAX_DELAY);
+    linkQueues[static_cast<size_t>(prio)].push_back(job);
+    xSemaphoreGive(linkQueueMutex);
+    if (linkTaskHandle) xTaskNotifyGive(linkTaskHandle);
+}
+
+LinkJobPtr linkSubmit(LinkPrio prio, const char *name, std::function<bool(String &)> run,
+                      std::function<void(bool, const String &)> done = nullptr) {
+    auto job = std::make_shared<LinkJob>();
+    job->name = name;
+    job->run = std::move(run);
+    job->done = std::move(done);
+    linkEnqueue(prio, job);
+    return job;
+}
+
+// Highest-priority job up to and including 'lowest', or null
+LinkJobPtr linkTake(LinkPrio lowest) {
+    LinkJobPtr job;
+    xSemaphoreTake(linkQueueMutex, portMAX_DELAY);
+    for (size_t p = 0; p <= static_cast<size_t>(lowest); ++p) {
+        if (!linkQueues[p].empty()) {
+            job = linkQueues[p].front();
+            linkQueues[p].pop_front();
+            break;
+        }
+    }
+    xSemaphoreGive(linkQueueMutex);
+    return job;
+}
+
+void linkRun(const LinkJobPtr &job) {
+    xSemaphoreTake(linkQueueMutex, portMAX_DELAY);
+    const bool cancelled = job->cancelled;
+    job->started = !cancelled;
+    xSemaphoreGive(linkQueueMutex);
+    if (cancelled) {
+        Serial.printf("[Link] %s cancelled\n", job->name);
+        return;
+    }
+    job->ok = job->run(job->err);
+    if (!job->ok && job->err.length() == 0) job->err = "failed";
+    if (job->done) job->done(job->ok, job->err);
+    if (job->doneSem) xSemaphoreGive(job->doneSem);
+}
+
+// Tm4cLink::betweenOps: let queued URGENT jobs jump into a long operation
+void linkRunUrgent() {
+    while (LinkJobPtr job = linkTake(LinkPrio::URGENT)) {
+        Serial.printf("[Link] %s preempts\n", job->name);
+        linkRun(job);
+    }
+}
+
+// Queue a job and wait for it. If it has not started when the timeout
+// expires it is cancelled and never runs ("link busy"); once started it is
+// waited for, which is bounded by its own command timeouts. A failure
+// returned here therefore always means the command did not take effect
+// later.
+bool linkCall(LinkPrio prio, const char *name, std::function<bool(String &)> run, String &err,
+              uint32_t timeoutMs = LINK_CALL_TIMEOUT_MS) {
+    if (xTaskGetCurrentTaskHandle() == linkTaskHandle) return run(err);
+    auto job = std::make_shared<LinkJob>();
+    job->name = name;
+    job->run = std::move(run);
+    job->doneSem = xSemaphoreCreateBinary();
+    linkEnqueue(prio, job);
+    if (xSemaphoreTake(job->doneSem, pdMS_TO_TICKS(timeoutMs)) != pdTRUE) {
+        xSemaphoreTake(linkQueueMutex, portMAX_DELAY);
+        const bool started = job->started;
+        job->cancelled = !started;
+        xSemaphoreGive(linkQueueMutex);
+        if (!started) {
+            err = "link busy";
+            return false;
+        }
+        xSemaphoreTake(job->doneSem, portMAX_DELAY);
+    }
+    err = job->err;
+    return job->ok;
+}
+
+// AT+SETTIME with the local time taken when the command goes out, not
+// when it was queued. 'done' runs on the link task.
+void linkSubmitTimeSync(std::function<void(bool, const String &)> done) {
+    linkSubmit(LinkPrio::NORMAL, "time_sync",
+               [](String &err) {
+                   time_t nowTs = time(nullptr) + timezoneOffsetSeconds;
+                   return tm4c.timeSync(static_cast<uint32_t>(nowTs), timezoneOffsetSeconds, err);
+               },
+               std::move(done));
+}
+
+// ---------- Single-flight read queries ----------
+// Read-only TM4C queries go through a per-query flight record. A request
+// for a query that is already queued or running attaches to it, and one
+// that completed within the caller's staleness window is answered from
+// that result (the cache already holds it). Either way only one command
+// reaches the UART, however many pollers ask at once.
+enum class LinkQueryId : uint8_t { STATUS = 0, SCHEDULE, SNAPSHOT, COUNT };
+static const char *const LINK_QUERY_NAMES[] = {"status", "schedule", "snapshot"};
+constexpr uint32_t STATUS_MAX_AGE_MS = 500;
+constexpr uint32_t SCHEDULE_MAX_AGE_MS = 2000;
+
+struct LinkFlight {
+    bool pending = false;         // queued or running
+    bool completed = false;       // lastOk/lastMs valid
+    bool lastOk = false;
+    uint32_t lastMs = 0;
+    String lastErr;
+    std::vector<std::function<void(bool, const String &)>> waiters;
+    uint32_t issued = 0;          // commands sent
+    uint32_t coalesced = 0;       // requests served by a pending or fresh flight
+};
+LinkFlight linkFlights[static_cast<size_t>(LinkQueryId::COUNT)];
+
+// 'done' (optional) runs on the link task, or right away on the caller's
+// task when a fresh result is reused.
+void linkQuery(LinkQueryId id, LinkPrio prio, uint32_t maxAgeMs, std::function<bool(String &)> run,
+               std::function<void(bool, const String &)> done = nullptr) {
+    LinkFlight &f = linkFlights[static_cast<size_t>(id)];
+    xSemaphoreTake(linkQueueMutex, portMAX_DELAY);
+    if (f.pending) {
+        f.coalesced++;
+        if (done) f.waiters.push_back(std::move(done));
+        xSemaphoreGive(linkQueueMutex);
+        return;
+    }
+    if (f.completed && f.lastOk && millis() - f.lastMs <= maxAgeMs) {
+        f.coalesced++;
+        String err = f.lastErr;
+        xSemaphoreGive(linkQueueMutex);
+        if (done) done(true, err);
+        return;
+    }
+    f.pending = true;
+    f.issued++;
+    if (done) f.waiters.push_back(std::move(done));
+    xSemaphoreGive(linkQueueMutex);
+
+    linkSubmit(prio, LINK_QUERY_NAMES[static_cast<size_t>(id)], std::move(run), [&f](bool ok, const String &err) {
+        std::vector<std::function<void(bool, const String &)>> waiters;
+        xSemaphoreTake(linkQueueMutex, portMAX_DELAY);
+        f.pending = false;
+        f.completed = true;
+        f.lastOk = ok;
+        f.lastErr = err;
+        f.lastMs = millis();
+        waiters.swap(f.waiters);
+        xSemaphoreGive(linkQueueMutex);
+        for (auto &w : waiters) w(ok, err);
+    });
+}
+
+void linkTask(void *) {
+    for (;;) {
+        if (LinkJobPtr job = linkTake(LinkPrio::BACKGROUND)) {
+            linkRun(job);
+            continue;
+        }
+        tm4c.poll();  // unsolicited AT+GETTIME / +EVT
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LINK_IDLE_WAIT_MS));
     }
-    json += "]";
-    return json;
+}
+
+void linkBegin() {
+    linkQueueMutex = xSemaphoreCreateMutex();
+    tm4c.betweenOps = linkRunUrgent;
+    tm4c.queueTimeSync = []() {
+        linkSubmitTimeSync([](bool ok, const String &err) {
+            tm4c.timeSyncQueued = false;
+            if (!ok) Serial.printf("[UART] time_sync fail: %s\n", err.c_str());
+        });
+    };
+    tm4c.begin();
+    xTaskCreatePinnedToCore(linkTask, "tm4c_link", LINK_TASK_STACK, nullptr, LINK_TASK_PRIO, &linkTaskHandle,
+                            ARDUINO_RUNNING_CORE);
 }
 
 int clampReading(int v) {
@@ -392,20 +1302,438 @@ int clampReading(int v) {
     return v;
 }
 
-String statusToJson() {
-    String json = "{";
-    json += "\"foodBowl\":" + String(clampReading(statusData.foodBowlG)) + ",";
-    json += "\"waterBowl\":" + String(clampReading(statusData.waterBowlG)) + ",";
-    json += "\"timeWarn\":" + String(timeDesyncWarning ? "true" : "false");
-    json += "}";
-    return json;
+uint32_t cacheAgeMs(uint32_t fetchedMs) {
+    return millis() - fetchedMs;
+}
+
+// The writers below read the caches; callers hold CacheLock
+
+// [{"time":"HH:MM","amount":"L|M|H"},...]
+void writeSchedule(JsonWriter &w) {
+    w.beginArray();
+    for (const auto &item : scheduleData) {
+        w.beginObject();
+        w.member("time", item.time);
+        w.member("amount", item.amount);
+        w.endObject();
+    }
+    w.endArray();
+}
+
+// {"age_ms":<n>,"items":[...]}
+void writeScheduleResponse(JsonWriter &w) {
+    w.beginObject();
+    w.member("age_ms", cacheAgeMs(scheduleFetchedMs));
+    w.key("items");
+    writeSchedule(w);
+    w.endObject();
+}
+
+// {"status":"idle|pending|processing|success|failed"[,"error":..][,"retry":n]}
+void writeScheduleTask(JsonWriter &w) {
+    const char *status = "idle";
+    switch (scheduleTask.state) {
+        case ScheduleTaskState::IDLE:
+            status = "idle";
+            break;
+        case ScheduleTaskState::PENDING:
+            status = "pending";
+            break;
+        case ScheduleTaskState::PROCESSING:
+            status = "processing";
+            break;
+        case ScheduleTaskState::SUCCESS:
+            status = "success";
+            break;
+        case ScheduleTaskState::FAILED:
+            status = "failed";
+            break;
+    }
+    w.beginObject();
+    w.member("status", status);
+    if (scheduleTask.state == ScheduleTaskState::FAILED && scheduleTask.errorMessage.length()) {
+        w.member("error", scheduleTask.errorMessage);
+    }
+    if (scheduleTask.state == ScheduleTaskState::PROCESSING) {
+        w.member("retry", scheduleTask.retryCount);
+    }
+    w.endObject();
+}
+
+// Members shared by status and snapshot
+void writeStatusFields(JsonWriter &w) {
+    w.member("foodBowl", clampReading(statusData.foodBowlG));
+    w.member("waterBowl", clampReading(statusData.waterBowlG));
+    w.member("timeWarn", timeDesyncWarning);
+    w.member("alarm", statusData.alarm);
+    w.member("busy", statusData.busy);
+}
+
+// Everything the page needs on first load
+void writeSnapshot(JsonWriter &w) {
+    w.beginObject();
+    w.member("age_ms", cacheAgeMs(statusFetchedMs));
+    writeStatusFields(w);
+    w.key("schedule");
+    writeSchedule(w);
+    w.key("lastFed");
+    w.beginObject();
+    w.member("time", deviceInfo.lastFedTime);
+    w.member("amount", deviceInfo.lastFedAmount);
+    w.endObject();
+    w.key("lastEaten");
+    w.beginObject();
+    w.member("time", deviceInfo.lastEatenTime);
+    w.member("grams", deviceInfo.lastEatenAmount);
+    w.member("durationS", deviceInfo.lastEatenDurationS);
+    w.endObject();
+    w.member("fw", deviceInfo.fwVersion);
+    w.member("boots", deviceInfo.bootCount);
+    w.member("linkBaud", deviceInfo.linkBaud);
+    w.endObject();
+}
+
+// Push messages leave out age_ms so identical readings compare equal
+void writeStatus(JsonWriter &w, bool withAge) {
+    w.beginObject();
+    if (withAge) w.member("age_ms", cacheAgeMs(statusFetchedMs));
+    writeStatusFields(w);
+    w.member("pump", statusData.pumpOn);
+    w.member("feedPct", statusData.feedPct);
+    w.member("health", statusData.health);
+    w.endObject();
+}
+
+// Stream a JSON body; 'fill' runs with CacheLock held
+template <typename Fill>
+void sendJson(AsyncWebServerRequest *request, Fill fill) {
+    AsyncResponseStream *response = request->beginResponseStream("application/json");
+    {
+        CacheLock lock;
+        JsonWriter w(*response);
+        fill(w);
+    }
+    request->send(response);
+}
+
+
+// Queue status/schedule/task messages for the push clients when they
+// changed since the last call (loop()). Status is pushed without age_ms so
+// identical readings are not re-sent.
+void pushState() {
+    static uint32_t sentStatusVersion = 0, sentScheduleVersion = 0;
+    static String lastStatus;
+    static ScheduleTaskState lastTaskState = ScheduleTaskState::IDLE;
+    static int lastTaskRetry = 0;
+    xSemaphoreTake(pushMutex, portMAX_DELAY);
+    const bool anyClient = !pushClients.empty();  // onWsEvent adds/removes on the AsyncTCP task
+    xSemaphoreGive(pushMutex);
+    if (!anyClient) return;
+
+    String status, schedule, task;
+    {
+        CacheLock lock;
+        if (statusCached && statusVersion != sentStatusVersion) {
+            sentStatusVersion = statusVersion;
+            status = pushMessage("status", [](JsonWriter &w) { writeStatus(w, false); });
+        }
+        if (scheduleCached && scheduleVersion != sentScheduleVersion) {
+            sentScheduleVersion = scheduleVersion;
+            schedule = pushMessage("schedule", writeSchedule);
+        }
+        if (scheduleTask.state != lastTaskState || scheduleTask.retryCount != lastTaskRetry) {
+            lastTaskState = scheduleTask.state;
+            lastTaskRetry = scheduleTask.retryCount;
+            task = pushMessage("task", writeScheduleTask);
+        }
+    }
+    if (status.length() && status != lastStatus) {
+        lastStatus = status;
+        pushAll(PushTopic::STATUS, status);
+    }
+    if (schedule.length()) pushAll(PushTopic::SCHEDULE, schedule);
+    if (task.length()) pushAll(PushTopic::TASK, task);
+}
+
+// Drain each client's outbox as far as its socket queue allows
+void pushFlush() {
+    xSemaphoreTake(pushMutex, portMAX_DELAY);
+    for (auto it = pushClients.begin(); it != pushClients.end();) {
+        AsyncWebSocketClient *c = ws.client(it->id);
+        if (!c || c->status() != WS_CONNECTED) {
+            it = pushClients.erase(it);
+            continue;
+        }
+        while (!it->outbox.empty() && c->canSend()) {
+            c->text(it->outbox.front().text);
+            it->outbox.pop_front();
+        }
+        ++it;
+    }
+    xSemaphoreGive(pushMutex);
+    ws.cleanupClients();
+}
+
+void onWsEvent(AsyncWebSocket *, AsyncWebSocketClient *client, AwsEventType type, void *, uint8_t *, size_t) {
+    if (type == WS_EVT_CONNECT) {
+        // A new page gets the full current state first
+        PushClient pc;
+        pc.id = client->id();
+        {
+            CacheLock lock;
+            if (statusCached) pushTo(pc, PushTopic::STATUS, pushMessage("status", [](JsonWriter &w) { writeStatus(w, true); }));
+            if (scheduleCached) pushTo(pc, PushTopic::SCHEDULE, pushMessage("schedule", writeSchedule));
+        }
+        pushTo(pc, PushTopic::TASK, pushMessage("task", writeScheduleTask));
+        xSemaphoreTake(pushMutex, portMAX_DELAY);
+        pushClients.push_back(std::move(pc));
+        xSemaphoreGive(pushMutex);
+        Serial.printf("[WS] client %lu connected\n", static_cast<unsigned long>(client->id()));
+    } else if (type == WS_EVT_DISCONNECT) {
+        xSemaphoreTake(pushMutex, portMAX_DELAY);
+        for (auto it = pushClients.begin(); it != pushClients.end(); ++it) {
+            if (it->id == client->id()) {
+                if (it->dropped) {
+                    Serial.printf("[WS] client %lu dropped %lu messages\n", static_cast<unsigned long>(it->id),
+                                  static_cast<unsigned long>(it->dropped));
+                }
+                pushClients.erase(it);
+                break;
+            }
+        }
+        xSemaphoreGive(pushMutex);
+    }
+}
+
+// ---------- Retained-mode dashboard ----------
+// Every widget remembers a hash of what it last drew and repaints only its
+// own rectangle, through one band-sized sprite, when that changes. A page
+// is cleared once when it is entered (uiEnterPage); after that a frame
+// costs only the widgets whose content changed, with no visible clear.
+constexpr int16_t UI_BAR_H = 18;
+constexpr int16_t UI_BAND_H = 24;     // sprite height: tallest widget (schedule row)
+constexpr int16_t UI_ROW_Y0 = 60;     // first schedule row
+constexpr int8_t UI_PAGE_NONE = -1;   // panel holds something else (boot text)
+
+struct Widget {
+    int16_t x, y, w, h;
+    uint32_t key;  // hash of the content last drawn, 0 = needs drawing
+};
+
+struct UiStats {
+    uint32_t frames = 0;        // frames that drew anything
+    uint32_t pageClears = 0;
+    uint32_t lastBytes = 0;     // pixel bytes sent over SPI in the last frame
+    uint32_t lastUs = 0;
+    uint32_t maxUs = 0;
+    uint32_t lastWidgets = 0;
+    uint64_t totalBytes = 0;
+    uint32_t qrModules = 0;     // last QR bench (/api/ui_stats?qr_bench)
+    uint32_t qrModuleUs = 0;    // one fillRect per dark module, as drawQr used to
+    uint32_t qrBlitUs = 0;      // pushSprite of the cached raster
+    uint32_t qrDrawUs = 0;      // the QR code in the last QR frame (raster if rebuilt, then blit)
+};
+
+TFT_eSprite uiBand(&tft);
+bool uiBandOk = false;  // false: widgets draw straight to the panel
+UiStats uiStats;
+int8_t uiPage = UI_PAGE_NONE;
+uint32_t uiQrKey = 0;
+volatile bool qrBenchRequested = false;  // set by /api/ui_stats?qr_bench (AsyncTCP), run on the next QR draw
+uint32_t uiFrameStartUs = 0;
+uint32_t uiFrameBytes = 0;
+uint32_t uiFrameWidgets = 0;
+bool lastClockWarn = false;
+
+Widget wBar, wClock, wDots;                 // status bar and page dots, every page
+Widget wFood, wWater, wRefill;              // status page
+constexpr size_t UI_MAX_ROWS = 6;
+Widget wRows[UI_MAX_ROWS];                  // schedule page
+
+// FNV-1a of the formatted content; never 0
+uint32_t uiKeyf(const char *fmt, ...) {
+    char buf[64];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    uint32_t h = 2166136261u;
+    for (const char *c = buf; *c; ++c) {
+        h ^= static_cast<uint8_t>(*c);
+        h *= 16777619u;
+    }
+    return h ? h : 1;
+}
+
+void uiCountPixels(int32_t w, int32_t h) {
+    uiFrameBytes += static_cast<uint32_t>(w * h * 2);
+}
+
+void uiLayout() {
+    const int16_t w = tft.width(), h = tft.height();
+    wBar = {0, 0, w, UI_BAR_H, 0};
+    wClock = {0, 0, 40, UI_BAR_H, 0};
+    wDots = {static_cast<int16_t>(w / 2 - 12), static_cast<int16_t>(h - 8), 25, 5, 0};
+    wFood = {2, 44, static_cast<int16_t>(w / 2 - 4), UI_BAND_H, 0};
+    wWater = {static_cast<int16_t>(w / 2 + 2), 44, static_cast<int16_t>(w / 2 - 4), UI_BAND_H, 0};
+    wRefill = {static_cast<int16_t>(w / 2 + 2), 72, static_cast<int16_t>(w / 2 - 4), 12, 0};
+    for (size_t i = 0; i < UI_MAX_ROWS; ++i) {
+        wRows[i] = {0, static_cast<int16_t>(UI_ROW_Y0 + i * UI_BAND_H), w, UI_BAND_H, 0};
+    }
+}
+
+void uiInvalidateWidgets() {
+    for (Widget *wd : {&wBar, &wClock, &wDots, &wFood, &wWater, &wRefill}) wd->key = 0;
+    for (Widget &wd : wRows) wd.key = 0;
+    uiQrKey = 0;
+}
+
+// Create the band sprite once the panel is up
+void uiBegin() {
+    uiBand.setColorDepth(16);
+    uiBandOk = uiBand.createSprite(tft.width(), UI_BAND_H) != nullptr;
+    if (!uiBandOk) Serial.println("[UI] band sprite alloc failed, drawing direct");
+    uiLayout();
+}
+
+// Clear the panel for a new page; every widget repaints on this frame
+void uiEnterPage(int8_t page, uint16_t bg) {
+    tft.fillScreen(bg);
+    uiCountPixels(tft.width(), tft.height());
+    uiInvalidateWidgets();
+    uiPage = page;
+    uiStats.pageClears++;
+}
+
+// Target to draw the widget into (local coordinates, cleared to bg), or
+// null when its content is unchanged
+TFT_eSPI *widgetBegin(Widget &wd, uint32_t key, uint16_t bg) {
+    if (wd.key == key) return nullptr;
+    wd.key = key;
+    if (uiBandOk) {
+        uiBand.fillRect(0, 0, wd.w, wd.h, bg);
+        return &uiBand;
+    }
+    tft.setViewport(wd.x, wd.y, wd.w, wd.h);
+    tft.fillRect(0, 0, wd.w, wd.h, bg);
+    return &tft;
+}
+
+void widgetEnd(const Widget &wd) {
+    if (uiBandOk) {
+        uiBand.pushSprite(wd.x, wd.y, 0, 0, wd.w, wd.h);
+    } else {
+        tft.resetViewport();
+    }
+    uiCountPixels(wd.w, wd.h);
+    uiFrameWidgets++;
+}
+
+void uiFrameBegin() {
+    uiFrameStartUs = micros();
+    uiFrameBytes = 0;
+    uiFrameWidgets = 0;
+}
+
+void uiFrameEnd(const char *page) {
+    if (!uiFrameBytes) return;  // nothing changed
+    const uint32_t us = micros() - uiFrameStartUs;
+    uiStats.frames++;
+    uiStats.lastBytes = uiFrameBytes;
+    uiStats.lastUs = us;
+    uiStats.lastWidgets = uiFrameWidgets;
+    uiStats.totalBytes += uiFrameBytes;
+    if (us > uiStats.maxUs) uiStats.maxUs = us;
+    Serial.printf("[UI] %s frame: %lu widgets, %lu B, %lu us\n", page, static_cast<unsigned long>(uiFrameWidgets),
+                  static_cast<unsigned long>(uiFrameBytes), static_cast<unsigned long>(us));
 }
 
 // ---------- Display helper ----------
+// The QR last drawn, rasterised at its display scale into a 1-bpp sprite
+// that is coloured as it is pushed. Redrawing the same code is a single
+// pushSprite; a new payload (gen) or scale re-rasterises it once, one
+// fillRect per horizontal run of dark modules.
+TFT_eSprite qrSprite(&tft);
+const QRSet *qrSpriteSet = nullptr;
+uint32_t qrSpriteGen = 0;
+uint8_t qrSpriteScale = 0;
+
+// fill(x, y, w, h) in pixels for every horizontal run of dark modules
+template <typename Fill>
+uint32_t qrForEachRun(const QRSet &qr, uint8_t scale, Fill fill) {
+    QRCode *code = const_cast<QRCode *>(&qr.qr);
+    uint32_t runs = 0;
+    for (uint8_t y = 0; y < code->size; y++) {
+        uint8_t x = 0;
+        while (x < code->size) {
+            if (!qrcode_getModule(code, x, y)) {
+                x++;
+                continue;
+            }
+            const uint8_t start = x;
+            while (x < code->size && qrcode_getModule(code, x, y)) x++;
+            fill(start * scale, y * scale, (x - start) * scale, scale);
+            runs++;
+        }
+    }
+    return runs;
+}
+
+// Make qrSprite hold qr at scale; false if the sprite cannot be allocated
+bool qrRaster(const QRSet &qr, uint8_t scale) {
+    if (qrSpriteSet == &qr && qrSpriteGen == qr.gen && qrSpriteScale == scale) return true;
+    const uint32_t t0 = micros();
+    const int16_t pix = qr.qr.size * scale;
+    if (qrSpriteSet) qrSprite.deleteSprite();
+    qrSpriteSet = nullptr;
+    qrSprite.setColorDepth(1);
+    if (!qrSprite.createSprite(pix, pix)) return false;
+    qrSprite.fillSprite(0);
+    const uint32_t runs = qrForEachRun(qr, scale, [](int32_t x, int32_t y, int32_t w, int32_t h) {
+        qrSprite.fillRect(x, y, w, h, 1);
+    });
+    qrSpriteSet = &qr;
+    qrSpriteGen = qr.gen;
+    qrSpriteScale = scale;
+    Serial.printf("[UI] QR raster %dx%d px, %lu runs, %lu us\n", pix, pix, static_cast<unsigned long>(runs),
+                  static_cast<unsigned long>(micros() - t0));
+    return true;
+}
+
+// Time the per-module drawing drawQr used before the sprite against the
+// sprite blit, both at the QR's place on the panel. The raster is built
+// before the blit is timed; drawQr blits again afterwards.
+void qrBench(const QRSet &qr, uint8_t scale, int x0, int y0, uint16_t qrColor) {
+    QRCode *code = const_cast<QRCode *>(&qr.qr);
+    uint32_t modules = 0;
+    uint32_t t0 = micros();
+    for (uint8_t y = 0; y < code->size; y++) {
+        for (uint8_t x = 0; x < code->size; x++) {
+            if (qrcode_getModule(code, x, y)) {
+                tft.fillRect(x0 + x * scale, y0 + y * scale, scale, scale, qrColor);
+                modules++;
+            }
+        }
+    }
+    uiStats.qrModules = modules;
+    uiStats.qrModuleUs = micros() - t0;
+    uiStats.qrBlitUs = 0;
+    if (qrRaster(qr, scale)) {
+        t0 = micros();
+        qrSprite.setBitmapColor(qrColor, COLOR_BG);
+        qrSprite.pushSprite(x0, y0);
+        uiStats.qrBlitUs = micros() - t0;
+    }
+    Serial.printf("[UI] QR bench %lu modules: per-module fillRect %lu us, sprite blit %lu us\n",
+                  static_cast<unsigned long>(modules), static_cast<unsigned long>(uiStats.qrModuleUs),
+                  static_cast<unsigned long>(uiStats.qrBlitUs));
+}
+
 void drawQr(const char *title, const QRSet *qr, uint16_t qrColor, bool clearScreen = true) {
     if (clearScreen) {
         tft.fillScreen(COLOR_BG);
     }
+    if (qr && !qr->gen) qr = nullptr;  // makeQr() not called yet
 
     uint8_t size = qr ? qr->qr.size : 0;
     uint8_t scale = qr ? std::max<uint8_t>(1, std::min<uint8_t>((tft.width() - 20) / size, (tft.height() - 40) / size)) : 1;
@@ -427,17 +1755,29 @@ void drawQr(const char *title, const QRSet *qr, uint16_t qrColor, bool clearScre
         return;
     }
 
-    for (uint8_t y = 0; y < size; y++) {
-        for (uint8_t x = 0; x < size; x++) {
-            if (qrcode_getModule(const_cast<QRCode *>(&qr->qr), x, y)) {
-                tft.fillRect(x0 + x * scale, y0 + y * scale, scale, scale, qrColor);
-            }
-        }
+    if (qrBenchRequested) {
+        qrBenchRequested = false;
+        qrBench(*qr, scale, x0, y0, qrColor);
     }
+
+    const uint32_t t0 = micros();
+    if (qrRaster(*qr, scale)) {
+        qrSprite.setBitmapColor(qrColor, COLOR_BG);
+        qrSprite.pushSprite(x0, y0);
+        uiCountPixels(qrPix, qrPix);
+    } else {
+        // No memory for the bitmap: runs straight to the panel
+        qrForEachRun(*qr, scale, [x0, y0, qrColor](int32_t x, int32_t y, int32_t w, int32_t h) {
+            tft.fillRect(x0 + x, y0 + y, w, h, qrColor);
+            uiCountPixels(w, h);
+        });
+    }
+    uiStats.qrDrawUs = micros() - t0;  // part of the QR frame that uiFrameEnd reports
 }
 
 void drawText(const char *line1, const char *line2 = nullptr) {
     tft.fillScreen(COLOR_BG);
+    uiPage = UI_PAGE_NONE;  // the next page render starts from a clear
     tft.setTextDatum(TC_DATUM);
     tft.setTextColor(COLOR_TEXT, COLOR_BG);
     tft.setTextFont(1);
@@ -447,106 +1787,206 @@ void drawText(const char *line1, const char *line2 = nullptr) {
     if (line2) tft.drawString(line2, tft.width() / 2, centerY + 24);
 }
 
-String currentTimeString() {
-    struct tm timeinfo{};
-    if (getLocalTime(&timeinfo, 500)) {
-        char buf[6];
-        strftime(buf, sizeof(buf), "%H:%M", &timeinfo);
-        return String(buf);
+// ---------- Clock ----------
+// Local time for the UI without blocking. poll() reads time() every loop
+// but converts it (localtime_r) only when the next wall-clock minute is
+// due, the clock jumps or its validity changes; each of those raises the
+// minute event that the status bar and schedule page redraw on.
+constexpr time_t CLOCK_VALID_AFTER = 1451606400;  // 2016-01-01, as getLocalTime() checks
+
+struct ClockService {
+    bool valid = false;       // SNTP has set the clock
+    struct tm local{};        // valid only if 'valid'
+    char hhmm[6] = "--:--";
+    time_t nextMinute = 0;    // epoch second the next minute starts
+    bool minuteEvent = true;  // draw once at start
+
+    void poll() {
+        const time_t now = time(nullptr);
+        const bool nowValid = now > CLOCK_VALID_AFTER;
+        // A jump back (NTP correction, new timezone) must not wait for the old boundary
+        if (nowValid == valid && (!valid || (now < nextMinute && now >= nextMinute - 60))) return;
+        valid = nowValid;
+        if (valid) {
+            localtime_r(&now, &local);
+            strftime(hhmm, sizeof(hhmm), "%H:%M", &local);
+            nextMinute = now - local.tm_sec + 60;
+        } else {
+            strcpy(hhmm, "--:--");
+        }
+        minuteEvent = true;
+    }
+
+    // Re-read on the next poll (timezone change)
+    void invalidate() { nextMinute = 0; }
+
+    bool takeMinuteEvent() {
+        const bool e = minuteEvent;
+        minuteEvent = false;
+        return e;
     }
-    return String("--:--");
+
+    int minutesOfDay() const { return valid ? local.tm_hour * 60 + local.tm_min : -1; }
+};
+ClockService wallClock;
+
+// What the display draws, copied from the caches under CacheLock at the
+// start of a render; the link task may replace them while a frame draws.
+// loop() only.
+struct DashView {
+    int foodBowlG = 0;
+    int waterBowlG = 0;
+    std::vector<ScheduleItem> schedule;
+};
+DashView dashView;
+
+void dashSnapshot(bool withSchedule) {
+    CacheLock lock;
+    dashView.foodBowlG = statusData.foodBowlG;
+    dashView.waterBowlG = statusData.waterBowlG;
+    if (withSchedule) dashView.schedule = scheduleData;
 }
 
 constexpr int WATER_BOWL_LOW_G = 80;
 bool hasAlertState() {
-    int water = clampReading(statusData.waterBowlG);
+    int water = clampReading(dashView.waterBowlG);
     return water < WATER_BOWL_LOW_G;
 }
 
-void drawWifiIcon(int x, int y, bool connected, uint16_t color, uint16_t bg) {
+void drawWifiIcon(TFT_eSPI &g, int x, int y, bool connected, uint16_t color, uint16_t bg) {
     if (connected) {
         // Use right-top quadrant arcs for compact Wi-Fi icon
-        tft.drawCircleHelper(x, y, 6, 0x1, color);
-        tft.drawCircleHelper(x, y, 4, 0x1, color);
-        tft.drawCircleHelper(x, y, 2, 0x1, color);
-        tft.fillCircle(x, y, 1, color);
+        g.drawCircleHelper(x, y, 6, 0x1, color);
+        g.drawCircleHelper(x, y, 4, 0x1, color);
+        g.drawCircleHelper(x, y, 2, 0x1, color);
+        g.fillCircle(x, y, 1, color);
     } else {
-        tft.fillRect(x - 5, y - 5, 10, 10, bg);
-        tft.setTextColor(color, bg);
-        tft.setCursor(x - 3, y - 4);
-        tft.print("x");
+        g.fillRect(x - 5, y - 5, 10, 10, bg);
+        g.setTextColor(color, bg);
+        g.setCursor(x - 3, y - 4);
+        g.print("x");
     }
 }
 
-void drawStatusBarDash(bool alert) {
-    uint16_t barColor = alert ? DASH_ALERT : DASH_PRIMARY;
-    tft.fillRect(0, 0, tft.width(), 18, barColor);
-    tft.setTextColor(DASH_WHITE, barColor);
-    tft.setTextFont(1);
-    tft.setTextSize(1);
-    tft.setCursor(4, 4);
-    String now = currentTimeString();
-    tft.print(now);
-    if (timeDesyncWarning) {
-        tft.setCursor(tft.width() / 2 - 16, 4);
-        tft.print("TIME?");
+void drawClockText(TFT_eSPI &g, const char *now, uint16_t barColor) {
+    g.setTextColor(DASH_WHITE, barColor);
+    g.setTextFont(1);
+    g.setTextSize(1);
+    g.setCursor(4, 4);
+    g.print(now);
+}
+
+// Bar background, TIME? warning and Wi-Fi icon change rarely and repaint
+// the whole bar; a new minute repaints only the clock
+void drawStatusBarDash(bool alert, bool showWarn = true) {
+    const uint16_t barColor = alert ? DASH_ALERT : DASH_PRIMARY;
+    const bool wifi = WiFi.status() == WL_CONNECTED;
+    const bool warn = showWarn && timeDesyncWarning;
+    const char *now = wallClock.hhmm;
+    const uint32_t clockKey = uiKeyf("%s %04x", now, barColor);
+    if (TFT_eSPI *g = widgetBegin(wBar, uiKeyf("%04x %d %d", barColor, wifi, warn), barColor)) {
+        drawClockText(*g, now, barColor);
+        if (warn) {
+            g->setCursor(wBar.w / 2 - 16, 4);
+            g->print("TIME?");
+        }
+        drawWifiIcon(*g, wBar.w - 12, 9, wifi, DASH_WHITE, barColor);
+        widgetEnd(wBar);
+        wClock.key = clockKey;
+    } else if (TFT_eSPI *g = widgetBegin(wClock, clockKey, barColor)) {
+        drawClockText(*g, now, barColor);
+        widgetEnd(wClock);
     }
-    drawWifiIcon(tft.width() - 12, 9, WiFi.status() == WL_CONNECTED, DASH_WHITE, barColor);
-    Serial.printf("[UI] StatusBar time=%s wifi=%s alert=%d\n", now.c_str(),
-                  WiFi.status() == WL_CONNECTED ? "on" : "off", alert);
+    lastClockWarn = timeDesyncWarning;
 }
 
-void drawPageDotsGeneric(uint8_t total, uint8_t active) {
-    int y = tft.height() - 6;
-    int cx = tft.width() / 2;
+void drawPageDotsGeneric(uint8_t total, uint8_t active, uint16_t bg) {
+    TFT_eSPI *g = widgetBegin(wDots, uiKeyf("%u %u %04x", total, active, bg), bg);
+    if (!g) return;
     int spread = (total - 1) * 8;
     for (int i = 0; i < total; ++i) {
-        int x = cx - spread / 2 + i * 8;
-        tft.drawCircle(x, y, 2, DASH_PRIMARY);
-        if (i == active) tft.fillCircle(x, y, 2, DASH_TEXT);
+        int x = wDots.w / 2 - spread / 2 + i * 8;
+        g->drawCircle(x, 2, 2, DASH_PRIMARY);
+        if (i == active) g->fillCircle(x, 2, 2, DASH_TEXT);
     }
+    widgetEnd(wDots);
+}
+
+// "<n>g" with the number at size 2, as the status page always had
+void drawGrams(Widget &wd, int grams) {
+    TFT_eSPI *g = widgetBegin(wd, uiKeyf("%d", grams), DASH_BG);
+    if (!g) return;
+    g->setTextColor(DASH_TEXT, DASH_BG);
+    g->setTextFont(1);
+    g->setTextSize(2);
+    g->setCursor(2, 4);
+    g->print(grams);
+    g->setTextSize(1);
+    g->print("g");
+    widgetEnd(wd);
 }
 
 void drawDashStatusPage() {
-    tft.fillScreen(DASH_BG);
+    const int8_t page = static_cast<int8_t>(DisplayMode::DASH_STATUS);
+    if (uiPage != page) {
+        uiEnterPage(page, DASH_BG);
+        // Static chrome
+        tft.setTextColor(DASH_TEXT, DASH_BG);
+        tft.drawFastVLine(tft.width() / 2, 20, tft.height() - 28, DASH_PRIMARY);
+        tft.setTextFont(1); tft.setTextSize(1);
+        tft.setCursor(4, 28); tft.print("Bowl(F)");
+        tft.setCursor(tft.width() / 2 + 4, 28); tft.print("Bowl(W)");
+    }
     bool alert = hasAlertState();
     drawStatusBarDash(alert);
-    int foodVal = clampReading(statusData.foodBowlG);
-    int waterVal = clampReading(statusData.waterBowlG);
-    tft.setTextColor(DASH_TEXT, DASH_BG);
-    tft.drawFastVLine(tft.width() / 2, 20, tft.height() - 28, DASH_PRIMARY);
-
-    // Food Bowl
-    tft.setTextFont(1); tft.setTextSize(1);
-    tft.setCursor(4, 28); tft.print("Bowl(F)");
-    tft.setTextSize(2);
-    tft.setCursor(4, 48); tft.print(foodVal); tft.setTextSize(1); tft.print("g");
-
-    // Water Bowl
-    tft.setTextSize(1);
-    int rightX = tft.width() / 2 + 4;
-    tft.setCursor(rightX, 28); tft.print("Bowl(W)");
-    tft.setTextSize(2);
-    tft.setCursor(rightX, 48); tft.print(waterVal); tft.setTextSize(1); tft.print("g");
-    if (waterVal < WATER_BOWL_LOW_G) {
-        tft.setTextColor(DASH_ALERT, DASH_BG);
-        tft.setCursor(rightX, 74); tft.print("REFILL");
-        tft.setTextColor(DASH_TEXT, DASH_BG);
+    int foodVal = clampReading(dashView.foodBowlG);
+    int waterVal = clampReading(dashView.waterBowlG);
+    drawGrams(wFood, foodVal);
+    drawGrams(wWater, waterVal);
+
+    const bool refill = waterVal < WATER_BOWL_LOW_G;
+    if (TFT_eSPI *g = widgetBegin(wRefill, uiKeyf("%d", refill), DASH_BG)) {
+        if (refill) {
+            g->setTextColor(DASH_ALERT, DASH_BG);
+            g->setTextFont(1);
+            g->setTextSize(1);
+            g->setCursor(2, 2);
+            g->print("REFILL");
+        }
+        widgetEnd(wRefill);
     }
 
-    drawPageDotsGeneric(3, 1);
-    Serial.printf("[UI] Page STATUS fb=%dg wb=%dg\n",
-                  statusData.foodBowlG, statusData.waterBowlG);
+    drawPageDotsGeneric(3, 1, DASH_BG);
+}
+
+// One schedule page row: a white pill with an optional coloured label
+void drawScheduleRow(Widget &wd, const char *label, const String &text, bool pill) {
+    TFT_eSPI *g = widgetBegin(wd, uiKeyf("%d %s|%s", pill, label, text.c_str()), DASH_BG);
+    if (!g) return;
+    const uint16_t bg = pill ? DASH_WHITE : DASH_BG;
+    if (pill) g->fillRoundRect(6, 0, wd.w - 12, 20, 4, DASH_WHITE);
+    g->setTextFont(1);
+    g->setTextSize(1);
+    g->setCursor(pill ? 12 : 10, 6);
+    if (label[0]) {
+        g->setTextColor(DASH_PRIMARY, bg);
+        g->print(label);
+    }
+    g->setTextColor(DASH_TEXT, bg);
+    g->print(text);
+    widgetEnd(wd);
 }
 
 void drawDashSchedulePage() {
-    tft.fillScreen(DASH_BG);
+    const int8_t page = static_cast<int8_t>(DisplayMode::DASH_SCHEDULE);
+    if (uiPage != page) {
+        uiEnterPage(page, DASH_BG);
+        tft.setTextColor(DASH_TEXT, DASH_BG);
+        tft.setTextFont(1); tft.setTextSize(2);
+        tft.setCursor(6, 30); tft.print("Plan");
+    }
     bool alert = hasAlertState();
     drawStatusBarDash(alert);
-    tft.setTextColor(DASH_TEXT, DASH_BG);
-    tft.setTextFont(1); tft.setTextSize(2);
-    tft.setCursor(6, 30); tft.print("Plan");
-    tft.setTextSize(1);
 
     auto toMinutes = [](const String &ts) -> int {
         int colon = ts.indexOf(':');
@@ -557,10 +1997,10 @@ void drawDashSchedulePage() {
         return h * 60 + m;
     };
 
-    int nowMin = toMinutes(currentTimeString());
+    int nowMin = wallClock.minutesOfDay();
     std::vector<std::pair<int, ScheduleItem>> ordered;
-    ordered.reserve(scheduleData.size());
-    for (auto &item : scheduleData) {
+    ordered.reserve(dashView.schedule.size());
+    for (auto &item : dashView.schedule) {
         int mins = toMinutes(item.time);
         if (mins >= 0) ordered.push_back({mins, item});
     }
@@ -605,55 +2045,34 @@ void drawDashSchedulePage() {
         idx = startNext;
         while (nextItems.size() < 3) {
             nextItems.push_back(ordered[idx].second);
-            idx = (idx + 1) % ordered.size();
-        }
-    }
-
-    int y = 60;
-    if (hasPrev) {
-        tft.fillRoundRect(6, y, tft.width() - 12, 20, 4, DASH_WHITE);
-        tft.setCursor(12, y + 6);
-        tft.setTextColor(DASH_PRIMARY, DASH_WHITE);
-        tft.print("Prev ");
-        tft.setTextColor(DASH_TEXT, DASH_WHITE);
-        tft.print(prevItem.time + " " + prevItem.amount);
-        y += 24;
-    }
-
-    if (!nextItems.empty()) {
-        tft.setTextColor(DASH_PRIMARY, DASH_BG);
-        tft.setCursor(8, y - 2);
-        tft.print("Next");
-        tft.setTextColor(DASH_TEXT, DASH_BG);
-    }
-
-    for (size_t i = 0; i < nextItems.size() && y < tft.height() - 16; ++i) {
-        tft.fillRoundRect(6, y, tft.width() - 12, 20, 4, DASH_WHITE);
-        tft.setCursor(12, y + 6);
-        tft.setTextColor(DASH_TEXT, DASH_WHITE);
-        tft.print(nextItems[i].time + " " + nextItems[i].amount);
-        y += 24;
+            idx = (idx + 1) % ordered.size();
+        }
     }
 
-    if (!hasPrev && nextItems.empty()) {
-        tft.setTextColor(DASH_TEXT, DASH_BG);
-        tft.setCursor(10, y + 6);
-        tft.print("No schedule");
+    // Rows: Prev, then Next (labelled on the first), then blanks
+    size_t row = 0;
+    const size_t rows = std::min<size_t>(UI_MAX_ROWS, (tft.height() - 16 - UI_ROW_Y0 + UI_BAND_H - 1) / UI_BAND_H);
+    if (hasPrev) drawScheduleRow(wRows[row++], "Prev ", prevItem.time + " " + prevItem.amount, true);
+    for (size_t i = 0; i < nextItems.size() && row < rows; ++i) {
+        drawScheduleRow(wRows[row++], i == 0 ? "Next " : "", nextItems[i].time + " " + nextItems[i].amount, true);
     }
+    if (row == 0) drawScheduleRow(wRows[row++], "", "No schedule", false);
+    for (; row < rows; ++row) drawScheduleRow(wRows[row], "", "", false);
 
-    drawPageDotsGeneric(3, 2);
-    Serial.printf("[UI] Page SCHEDULE prev=%s nextCount=%u total=%u nowMin=%d\n",
-                  hasPrev ? prevItem.time.c_str() : "none",
-                  (unsigned)nextItems.size(), (unsigned)scheduleData.size(), nowMin);
+    drawPageDotsGeneric(3, 2, DASH_BG);
 }
 
 void renderDashboard() {
+    dashSnapshot(displayMode == DisplayMode::DASH_SCHEDULE);
+    uiFrameBegin();
     switch (displayMode) {
         case DisplayMode::DASH_STATUS:
             drawDashStatusPage();
+            uiFrameEnd("STATUS");
             break;
         case DisplayMode::DASH_SCHEDULE:
             drawDashSchedulePage();
+            uiFrameEnd("SCHEDULE");
             break;
         default:
             break;
@@ -683,47 +2102,42 @@ void drawCurrentQrStage() {
     uint16_t qrColor = (currentStage == Stage::ONLINE) ? COLOR_TEXT : COLOR_BLACK;
     bool showTitle = currentStage != Stage::ONLINE;  // hide text when online
     bool showBarAndDots = currentStage == Stage::ONLINE;
-
-    tft.fillScreen(COLOR_BG);
-
-    if (showBarAndDots) {
-        // Status bar on top of QR screens too
-        uint16_t barColor = hasAlertState() ? DASH_ALERT : DASH_PRIMARY;
-        tft.fillRect(0, 0, tft.width(), 18, barColor);
-        tft.setTextColor(DASH_WHITE, barColor);
-        tft.setTextFont(1);
-        tft.setTextSize(1);
-        tft.setCursor(4, 4);
-        String now = currentTimeString();
-        tft.print(now);
-        drawWifiIcon(tft.width() - 12, 9, WiFi.status() == WL_CONNECTED, DASH_WHITE, barColor);
-
-        // Clear content area below bar
-        tft.fillRect(0, 18, tft.width(), tft.height() - 24, COLOR_BG);
-
-        // Page dots: 3 pages (0:QR, 1:status, 2:schedule)
-        drawPageDotsGeneric(3, 0);
-    }
-
-    // Draw QR (without clearing screen)
+    const QRSet *qr = nullptr;
+    const char *title = "";
     switch (currentStage) {
         case Stage::JOIN_AP:
-            drawQr(showTitle ? "1) Join AP" : "", &qrJoinAp, qrColor, false);
-            Serial.println("[UI] Show Join-AP QR");
+            qr = &qrJoinAp;
+            title = "1) Join AP";
             break;
         case Stage::CONFIG_URL:
-            drawQr(showTitle ? "2) Config Page" : "", &qrConfigPage, qrColor, false);
-            Serial.println("[UI] Show Config URL QR");
+            qr = &qrConfigPage;
+            title = "2) Config Page";
             break;
         case Stage::ONLINE:
-            drawQr("", &qrMainPage, qrColor, false);
-            Serial.println("[UI] Show Online URL QR");
+            qr = &qrMainPage;
             break;
     }
+
+    uiFrameBegin();
+    // The QR only changes with the stage or its payload; otherwise just the
+    // status bar is brought up to date
+    const int8_t page = static_cast<int8_t>(DisplayMode::QR);
+    const uint32_t qrKey = uiKeyf("%d %lu", static_cast<int>(currentStage), static_cast<unsigned long>(qr->gen));
+    if (uiPage != page || qrKey != uiQrKey) {
+        uiEnterPage(page, COLOR_BG);
+        uiQrKey = qrKey;
+        drawQr(showTitle ? title : "", qr, qrColor, false);
+        Serial.printf("[UI] Show QR stage=%d\n", static_cast<int>(currentStage));
+    }
+
     if (showBarAndDots) {
-        lastQrTimeShown = currentTimeString();
-        lastQrTimeWarn = timeDesyncWarning;
+        dashSnapshot(false);
+        // Status bar on top of QR screens too (no TIME? warning here)
+        drawStatusBarDash(hasAlertState(), false);
+        // Page dots: 3 pages (0:QR, 1:status, 2:schedule)
+        drawPageDotsGeneric(3, 0, COLOR_BG);
     }
+    uiFrameEnd("QR");
 }
 
 void showStage(Stage stage) {
@@ -754,21 +2168,213 @@ void connectHome(const String &ssid, const String &pass) {
     WiFi.begin(homeSsid.c_str(), homePass.c_str());
 }
 
-void fetchStatusOnce() {
-    String err;
-    if (tm4c.getStatus(statusData, err)) {
-        displayDirty = true;
-    } else {
+// refresh*: one TM4C exchange into the cache, on the link task
+bool refreshStatus(String &err) {
+    StatusData s;
+    {
+        CacheLock lock;
+        s = statusData;
+    }
+    if (!tm4c.getStatus(s, err)) {
         Serial.printf("[UART] get_status fail: %s\n", err.c_str());
+        return false;
     }
+    CacheLock lock;
+    s.pumpOn = statusData.pumpOn;  // event-only, may have changed meanwhile
+    statusData = s;
+    statusVersion++;
+    statusCached = true;
+    statusFetchedMs = millis();
+    displayDirty = true;
+    return true;
 }
 
-void fetchScheduleOnce() {
-    String err;
-    if (tm4c.getSchedule(scheduleData, err)) {
-        displayDirty = true;
-    } else {
+bool refreshSchedule(String &err) {
+    std::vector<ScheduleItem> sched;
+    if (!tm4c.getSchedule(sched, err)) {
         Serial.printf("[UART] get_schedule fail: %s\n", err.c_str());
+        return false;
+    }
+    CacheLock lock;
+    scheduleData = sched;
+    scheduleVersion++;
+    scheduleCached = true;
+    scheduleFetchedMs = millis();
+    displayDirty = true;
+    return true;
+}
+
+// Boot-time bootstrap: one AT+SNAPSHOT instead of separate status,
+// schedule and log round trips. Falls back to the individual commands if
+// the TM4C firmware predates AT+SNAPSHOT.
+bool refreshSnapshot(String &err) {
+    uint32_t t0 = millis();
+    StatusData s;
+    std::vector<ScheduleItem> sched;
+    DeviceInfo info;
+    {
+        CacheLock lock;
+        s = statusData;
+        info = deviceInfo;
+    }
+    if (tm4c.getSnapshot(s, sched, info, err)) {
+        {
+            CacheLock lock;
+            s.pumpOn = statusData.pumpOn;
+            statusData = s;
+            scheduleData = sched;
+            deviceInfo = info;
+            statusVersion++;
+            scheduleVersion++;
+            statusCached = scheduleCached = true;
+            statusFetchedMs = scheduleFetchedMs = millis();
+        }
+        Serial.printf("[UART] snapshot in %lu ms (fw %s, boot %lu)\n", static_cast<unsigned long>(millis() - t0),
+                      info.fwVersion.c_str(), static_cast<unsigned long>(info.bootCount));
+        displayDirty = true;
+        return true;
+    }
+    Serial.printf("[UART] snapshot fail: %s\n", err.c_str());
+    bool ok = refreshStatus(err);
+    return refreshSchedule(err) && ok;
+}
+
+// fetch*Once: background cache refresh, coalesced with any identical one
+void fetchStatusOnce() {
+    linkQuery(LinkQueryId::STATUS, LinkPrio::BACKGROUND, STATUS_MAX_AGE_MS, refreshStatus);
+}
+
+void fetchScheduleOnce() {
+    linkQuery(LinkQueryId::SCHEDULE, LinkPrio::BACKGROUND, SCHEDULE_MAX_AGE_MS, refreshSchedule);
+}
+
+void fetchSnapshotOnce() {
+    linkQuery(LinkQueryId::SNAPSHOT, LinkPrio::NORMAL, STATUS_MAX_AGE_MS, refreshSnapshot);
+}
+
+// Echo latency and bulk throughput at 'rate' (negotiated first)
+LinkEchoResult measureEcho(uint32_t rate) {
+    LinkEchoResult e;
+    e.baud = rate;
+    if (!tm4c.negotiateBaud(rate)) return e;
+
+    uint32_t t0 = micros();
+    for (uint8_t i = 0; i < LINK_BENCH_RTT_ROUNDS; ++i) {
+        if (!tm4c.echoRoundTrip("P")) return e;
+    }
+    e.rttUs = (micros() - t0) / LINK_BENCH_RTT_ROUNDS;
+
+    String bulk;
+    bulk.reserve(LINK_BENCH_BULK_BYTES);
+    while (bulk.length() < LINK_BENCH_BULK_BYTES) bulk += static_cast<char>('A' + bulk.length() % 26);
+    // "AT+ECHO=" + CRLF out, "+OK: " + CRLF back
+    uint32_t bytesPerRound = 2 * LINK_BENCH_BULK_BYTES + 10 + 7;
+    t0 = micros();
+    for (uint8_t i = 0; i < LINK_BENCH_BULK_ROUNDS; ++i) {
+        if (!tm4c.echoRoundTrip(bulk, 500)) return e;
+    }
+    uint32_t us = micros() - t0;
+    e.bytesPerSec = static_cast<uint32_t>((uint64_t) bytesPerRound * LINK_BENCH_BULK_ROUNDS * 1000000ull / (us ? us : 1));
+    e.ok = true;
+    return e;
+}
+
+// Re-upload the current schedule (so device state is unchanged) with the
+// old paced writes and at line rate, alternating, and record the timings.
+// The TM4C skips the EEPROM write for an unchanged schedule, so the six
+// uploads cost no wear. Then compare echo latency/throughput at the
+// default and fast link rates. Runs on the link task.
+void runLinkBench() {
+    LinkBench r;
+    r.running = true;
+    {
+        CacheLock lock;
+        r.requested = linkBench.requested;
+        linkBench = r;
+    }
+    r.bytes = Tm4cLink::scheduleWireString(scheduleData).length() + 2;
+    for (uint8_t i = 0; i < LINK_BENCH_ROUNDS; ++i) {
+        for (uint8_t paced = 0; paced < 2; ++paced) {
+            String err;
+            uint32_t t0 = millis();
+            bool ok = tm4c.setSchedule(scheduleData, err, paced ? LINK_BENCH_PACE_MS : 0);
+            uint32_t dt = millis() - t0;
+            if (paced) {
+                r.pacedTotalMs += dt;
+                r.pacedMaxMs = std::max(r.pacedMaxMs, dt);
+                r.pacedOk += ok;
+            } else {
+                r.lineTotalMs += dt;
+                r.lineMaxMs = std::max(r.lineMaxMs, dt);
+                r.lineOk += ok;
+            }
+        }
+    }
+    uint32_t linkRate = tm4c.baud;
+    r.echo[0] = measureEcho(UART_BAUD);
+    r.echo[1] = measureEcho(UART_FAST_BAUD);
+    tm4c.negotiateBaud(linkRate);
+    r.running = false;
+    r.valid = true;
+    {
+        CacheLock lock;
+        r.requested = linkBench.requested;
+        linkBench = r;
+    }
+    Serial.printf("[Bench] schedule %u bytes: paced avg %lu ms, line rate avg %lu ms\n",
+                  static_cast<unsigned>(r.bytes),
+                  static_cast<unsigned long>(r.pacedTotalMs / LINK_BENCH_ROUNDS),
+                  static_cast<unsigned long>(r.lineTotalMs / LINK_BENCH_ROUNDS));
+}
+
+// Schedule update (POST /api/schedule), on the link task. Retries until
+// MAX_RETRIES or TASK_TIMEOUT_MS from startMs; a feed request may run
+// between attempts and between the individual edits.
+bool runScheduleTask(const std::vector<ScheduleItem> &items, uint32_t startMs, String &err) {
+    const int MAX_RETRIES = 5;  // Reduced from 10
+    const uint32_t TASK_TIMEOUT_MS = 30000;  // 30 seconds total timeout
+    int retries = 0;
+    // A newer POST may have re-queued the task meanwhile; leave its state alone
+    auto publish = [&retries](ScheduleTaskState st, const String &msg) {
+        CacheLock lock;
+        if (scheduleTask.state != ScheduleTaskState::PROCESSING) return;
+        scheduleTask.state = st;
+        scheduleTask.errorMessage = msg;
+        scheduleTask.retryCount = retries;
+    };
+
+    while (true) {
+        if (millis() - startMs > TASK_TIMEOUT_MS) {
+            err = "Timeout after " + String(retries) + " retries";
+            publish(ScheduleTaskState::FAILED, err);
+            Serial.printf("[Async] Schedule update timeout after %d retries\n", retries);
+            return false;
+        }
+        std::vector<ScheduleItem> device;
+        if (tm4c.updateSchedule(items, device, err)) {
+            {
+                CacheLock lock;
+                scheduleData = device;
+                scheduleVersion++;
+                scheduleCached = true;
+                scheduleFetchedMs = millis();
+            }
+            publish(ScheduleTaskState::SUCCESS, "");
+            displayDirty = true;
+            Serial.printf("[Async] Schedule update SUCCESS after %d attempts\n", retries + 1);
+            return true;
+        }
+        retries++;
+        Serial.printf("[Async] Schedule update retry %d/%d failed: %s\n", retries, MAX_RETRIES, err.c_str());
+        if (retries >= MAX_RETRIES) {
+            if (!err.length()) err = "Failed after retries";
+            publish(ScheduleTaskState::FAILED, err);
+            Serial.printf("[Async] Schedule update FAILED: %s\n", err.c_str());
+            return false;
+        }
+        publish(ScheduleTaskState::PROCESSING, "");
+        linkRunUrgent();
+        vTaskDelay(pdMS_TO_TICKS(200));
     }
 }
 
@@ -827,17 +2433,14 @@ bool syncTimeAndTm4c() {
         }
 
         lastNtpSyncMs = millis();
+        wallClock.invalidate();  // the timezone may have changed
         char buf[64];
         strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &timeinfo);
         Serial.printf("[NTP] Synced time: %s (tz=%d)\n", buf, timezoneOffsetSeconds);
-        time_t nowTs = time(nullptr) + timezoneOffsetSeconds;
-        String err;
-        if (!tm4c.timeSync(static_cast<uint32_t>(nowTs), timezoneOffsetSeconds, err)) {
-            Serial.printf("[UART] time_sync fail: %s\n", err.c_str());
-            timeDesyncWarning = true;
-        } else {
-            timeDesyncWarning = false;
-        }
+        linkSubmitTimeSync([](bool ok, const String &err) {
+            if (!ok) Serial.printf("[UART] time_sync fail: %s\n", err.c_str());
+            timeDesyncWarning = !ok;
+        });
         return true;
     }
     Serial.println("[NTP] No WiFi, cannot sync");
@@ -870,977 +2473,499 @@ bool syncTimeAndTm4c() {
 }
 #endif
 
-// ---------- Web routes ----------
-const char *CONFIG_PAGE = R"HTML(
-<!DOCTYPE html>
-<html lang="en"><head>
-<meta charset="UTF-8">
-<meta name="viewport" content="width=device-width, initial-scale=1.0, maximum-scale=1.0, user-scalable=no">
-<title>WiFi Setup</title>
-<style>
-*{box-sizing:border-box;margin:0;padding:0;outline:none;-webkit-tap-highlight-color:transparent;}
-body{font-family:-apple-system,BlinkMacSystemFont,"Segoe UI",Roboto,Helvetica,Arial,sans-serif;background:#FFF8F0;color:#6D4C41;display:flex;align-items:center;justify-content:center;min-height:100vh;padding:20px;}
-.container{background:#FFF;width:100%;max-width:360px;padding:40px 30px;border-radius:30px;box-shadow:0 10px 25px rgba(255,183,178,0.2);text-align:center;position:relative;overflow:hidden;}
-.container::before{content:'';position:absolute;top:0;left:0;width:100%;height:8px;background:#FFB7B2;}
-.kaomoji{font-size:50px;font-weight:bold;color:#FFB7B2;margin-bottom:10px;display:inline-block;white-space:nowrap;animation:bounce 2s infinite ease-in-out;text-shadow:2px 2px 0px #FFF,4px 4px 0px rgba(255,183,178,0.3);}
-h1{font-size:24px;font-weight:700;margin-bottom:8px;color:#5D4037;}
-p{font-size:14px;color:#A1887F;margin-bottom:30px;}
-.form-group{margin-bottom:20px;text-align:left;}
-label{display:block;font-size:13px;font-weight:600;margin-bottom:8px;margin-left:10px;color:#8D6E63;text-transform:uppercase;letter-spacing:0.5px;}
-select,input{width:100%;padding:14px 20px;border:2px solid #FBE9E7;border-radius:20px;font-size:16px;background:#FFFDFB;color:#5D4037;transition:all .3s ease;appearance:none;}
-.select-wrapper{position:relative;}
-.select-wrapper::after{content:'▼';font-size:12px;color:#FFB7B2;position:absolute;right:20px;top:50%;transform:translateY(-50%);pointer-events:none;}
-select:focus,input:focus{border-color:#FFB7B2;background:#FFF;box-shadow:0 0 0 4px rgba(255,183,178,0.2);}
-button{width:100%;padding:16px;margin-top:10px;background:#FFB7B2;color:#FFF;border:none;border-radius:20px;font-size:16px;font-weight:bold;cursor:pointer;transition:transform .1s ease,background-color .3s;box-shadow:0 4px 10px rgba(255,183,178,0.4);}
-button:active{transform:scale(0.96);background:#FF8A65;}
-button.loading{background:#D7CCC8;pointer-events:none;cursor:default;}
-@keyframes bounce{0%,100%{transform:translateY(0);}50%{transform:translateY(-10px);}}
-.footer{margin-top:25px;font-size:12px;color:#D7CCC8;}
-</style>
-</head>
-<body>
-  <div class="container">
-    <div class="kaomoji">(=^･ω･^=)</div>
-    <h1>Hello Human!</h1>
-    <p>Please connect me to the internet ~</p>
-    <form id="wifiForm" action="/configure" method="POST">
-      <div class="form-group">
-        <label for="ssid">Network Name</label>
-        <div class="select-wrapper" id="ssid-wrapper">
-          <select id="ssid" name="ssid" required>
-            <option value="" disabled selected>Searching...</option>
-          </select>
-        </div>
-      </div>
-      <div class="form-group">
-        <label for="password">Password</label>
-        <input type="password" id="password" name="password" placeholder="Leave empty if open">
-      </div>
-      <div class="form-group">
-        <label for="tz">Timezone</label>
-        <div class="select-wrapper">
-          <select id="tz" name="tzOffset" required>
-            <option value="28800" selected>GMT+08:00 (Beijing)</option>
-            <option value="0">GMT+00:00 (UTC)</option>
-            <option value="19800">GMT+05:30 (India)</option>
-            <option value="25200">GMT+07:00 (Bangkok)</option>
-            <option value="32400">GMT+09:00 (Tokyo)</option>
-            <option value="3600">GMT+01:00 (Berlin)</option>
-            <option value="-18000">GMT-05:00 (New York)</option>
-            <option value="-25200">GMT-07:00 (Denver)</option>
-            <option value="-28800">GMT-08:00 (San Francisco)</option>
-          </select>
-        </div>
-      </div>
-      <button type="submit" id="saveBtn">Save & Connect</button>
-      <button type="button" id="resetBtn" style="margin-top:24px;background:#E0E0E0;color:#6D4C41">Reset Wi-Fi</button>
-    </form>
-    <div class="footer">Pet Device Configuration</div>
-  </div>
-    <script>
-    async function loadNetworks(attempt=0){
-      try{
-        const res = await fetch('/scan');
-        const list = await res.json();
-        const wrapper = document.getElementById('ssid-wrapper');
-        const sel = document.getElementById('ssid');
-        if (list.length === 0) {
-          sel.innerHTML = '<option value=\"\" disabled selected>Searching...</option>';
-          if (attempt < 5) {
-            setTimeout(()=>loadNetworks(attempt+1), 1200);
-          } else {
-            wrapper.innerHTML = '<input id=\"ssid\" name=\"ssid\" required placeholder=\"Enter SSID manually\" style=\"width:100%;padding:14px 20px;border:2px solid #FBE9E7;border-radius:20px;font-size:16px;background:#FFFDFB;color:#5D4037;\" />';
-          }
-        } else {
-          sel.innerHTML = '<option value=\"\" disabled selected>Select WiFi</option>';
-          list.forEach(ssid=>{
-            const opt=document.createElement('option');
-            opt.value=ssid; opt.textContent=ssid;
-            sel.appendChild(opt);
-          });
-        }
-      }catch(e){
-        const wrapper = document.getElementById('ssid-wrapper');
-        wrapper.innerHTML='<input id=\"ssid\" name=\"ssid\" required placeholder=\"Enter SSID manually\" style=\"width:100%;padding:14px 20px;border:2px solid #FBE9E7;border-radius:20px;font-size:16px;background:#FFFDFB;color:#5D4037;\" />';
-      }
-    }
-
-    async function loadTz(){
-      try{
-        const res = await fetch('/api/tz');
-        const json = await res.json();
-        if (typeof json.tzOffset !== 'undefined') {
-          document.getElementById('tz').value = json.tzOffset;
-        }
-      }catch(e){
-        console.warn('loadTz failed', e);
-      }
-    }
-
-    document.getElementById('wifiForm').addEventListener('submit', async (e)=>{
-      e.preventDefault();
-      const btn=document.getElementById('saveBtn');
-      btn.textContent='Connecting...';
-      btn.classList.add('loading');
-      const fd=new FormData(e.target);
-      await fetch('/configure',{method:'POST',body:fd});
-      btn.textContent='Saved';
-    });
-    document.getElementById('resetBtn').addEventListener('click', async ()=>{
-      if (!confirm('Confirm reset Wi-Fi settings?')) return;
-      const btn=document.getElementById('resetBtn');
-      btn.textContent='Resetting...';
-      btn.classList.add('loading');
-      await fetch('/reset');
-      btn.textContent='Done';
-    });
-    window.onload=()=>{
-      loadNetworks();
-      loadTz();
-    };
-  </script>
-</body>
-</html>
-)HTML";
-
-const char *HOME_PAGE = R"HTML(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0, maximum-scale=1.0, user-scalable=no">
-    <title>Pet Dashboard</title>
-    <style>
-        /* Warm & Cute Palette */
-        :root {
-            --bg-color: #FFF8F0;
-            --card-bg: #FFFFFF;
-            --primary: #FFB7B2;    /* Pinkish */
-            --primary-dark: #FF8A65; /* Orange */
-            --text-main: #6D4C41;  /* Chocolate */
-            --text-sub: #A1887F;
-            --alert: #FF5252;      /* Red for warnings */
-            --success: #81C784;    /* Green for High/OK */
-        }
-
-        * { box-sizing: border-box; margin: 0; padding: 0; -webkit-tap-highlight-color: transparent; outline: none; }
-
-        body {
-            font-family: "Nunito", -apple-system, sans-serif; /* Rounder font if available */
-            background-color: var(--bg-color);
-            color: var(--text-main);
-            padding: 20px;
-            max-width: 480px;
-            margin: 0 auto;
-        }
-
-        /* --- Header --- */
-        #alert-banner {
-            background: var(--alert);
-            color: #fff;
-            padding: 12px 14px;
-            border-radius: 14px;
-            margin-bottom: 14px;
-            font-weight: 800;
-            box-shadow: 0 6px 16px rgba(255, 82, 82, 0.35);
-            text-align: center;
-        }
-
-        header {
-            display: flex;
-            justify-content: space-between;
-            align-items: center;
-            margin-bottom: 25px;
-        }
-
-        h1 { font-size: 22px; font-weight: 800; }
-        .kaomoji-header { color: var(--primary); font-size: 14px; display: block; }
-        
-        .settings-btn {
-            background: none;
-            border: none;
-            font-size: 24px;
-            cursor: pointer;
-            color: var(--text-sub);
-            transition: transform 0.3s;
-        }
-        .settings-btn:active { transform: rotate(90deg); }
-
-        .quick-actions {
-            display: flex;
-            gap: 12px;
-            margin-bottom: 16px;
-        }
-
-        .feed-btn {
-            flex: 1;
-            background-color: var(--primary);
-            color: #fff;
-            border: none;
-            border-radius: 20px;
-            padding: 15px;
-            font-weight: bold;
-            font-size: 16px;
-            box-shadow: 0 4px 10px rgba(255, 183, 178, 0.4);
-            cursor: pointer;
-            transition: transform 0.15s ease, box-shadow 0.15s ease, background-color 0.2s ease;
-        }
-        .feed-btn:active { transform: scale(0.96); background-color: var(--primary-dark); box-shadow: none; }
-
-        /* --- Status Grid --- */
-        .status-grid {
-            display: grid;
-            grid-template-columns: 1fr 1fr;
-            gap: 15px;
-            margin-bottom: 25px;
-        }
-
-        .card {
-            background: var(--card-bg);
-            border-radius: 20px;
-            padding: 15px;
-            box-shadow: 0 4px 15px rgba(255, 183, 178, 0.15);
-            text-align: center;
-            position: relative;
-            transition: transform 0.2s;
-        }
-        
-        .card:active { transform: scale(0.98); }
-
-        .card-label { font-size: 12px; color: var(--text-sub); font-weight: 700; text-transform: uppercase; letter-spacing: 0.5px; margin-bottom: 5px; }
-        .card-value { font-size: 20px; font-weight: 800; color: var(--text-main); }
-        .card-icon { font-size: 24px; margin-bottom: 5px; display: block; }
-        .card-chip {
-            position: absolute;
-            bottom: 12px;
-            right: 12px;
-            padding: 4px 10px;
-            border-radius: 999px;
-            font-size: 10px;
-            font-weight: 800;
-            letter-spacing: 0.6px;
-            background: #FF7043;
-            color: #fff;
-            box-shadow: 0 4px 10px rgba(255,112,67,0.25);
-            text-transform: uppercase;
-            display: none;
-        }
-        
-        /* Alert States */
-        .is-alert { color: var(--alert) !important; animation: pulse 1.5s infinite; }
-        .is-ok { color: var(--success); }
-        
-        @keyframes pulse { 0% { opacity: 1; } 50% { opacity: 0.6; } 100% { opacity: 1; } }
-
-        /* --- Sections --- */
-        .section-title {
-            font-size: 16px;
-            font-weight: 700;
-            margin-bottom: 12px;
-            display: flex;
-            align-items: center;
-            gap: 8px;
-        }
-
-        .info-list {
-            background: var(--card-bg);
-            border-radius: 20px;
-            padding: 15px;
-            margin-bottom: 25px;
-            box-shadow: 0 4px 15px rgba(255, 183, 178, 0.15);
-        }
-
-        .info-item {
-            display: flex;
-            justify-content: space-between;
-            padding: 8px 0;
-            border-bottom: 1px solid #FFF0EB;
-            font-size: 14px;
-        }
-        .info-item:last-child { border-bottom: none; }
-        .info-time { color: var(--text-sub); }
-        .info-val { font-weight: 700; }
-
-        /* --- Schedule --- */
-        .schedule-list {
-            list-style: none;
-        }
-        
-        .schedule-item {
-            background: var(--card-bg);
-            border-radius: 15px;
-            padding: 12px 15px;
-            margin-bottom: 10px;
-            display: flex;
-            justify-content: space-between;
-            align-items: center;
-            box-shadow: 0 2px 8px rgba(0,0,0,0.03);
-        }
-
-        .sch-time { font-weight: 800; font-size: 18px; color: var(--text-main); }
-        .sch-amount { 
-            font-size: 12px; 
-            padding: 4px 10px; 
-            border-radius: 10px; 
-            background: #FFF0EB; 
-            color: var(--primary-dark); 
-            font-weight: bold;
-            margin-left: 10px;
-        }
-        .del-btn {
-            background: none;
-            border: none;
-            color: #FFCDD2;
-            font-size: 18px;
-            padding: 0 5px;
-            cursor: pointer;
-        }
-        .del-btn:hover { color: var(--alert); }
-
-        .add-btn {
-            width: 100%;
-            padding: 15px;
-            background-color: var(--primary);
-            color: white;
-            border: none;
-            border-radius: 20px;
-            font-size: 16px;
-            font-weight: bold;
-            cursor: pointer;
-            box-shadow: 0 4px 10px rgba(255, 183, 178, 0.4);
-            margin-bottom: 40px;
-        }
-        .add-btn:active { transform: scale(0.96); background-color: var(--primary-dark); }
-        .add-btn:disabled { background-color: #E0E0E0; color: #999; box-shadow: none; }
-
-        /* --- Modal --- */
-        .modal-overlay {
-            position: fixed; top: 0; left: 0; width: 100%; height: 100%;
-            background: rgba(109, 76, 65, 0.4);
-            backdrop-filter: blur(2px);
-            display: none;
-            justify-content: center;
-            align-items: center;
-            z-index: 100;
-        }
-        .modal {
-            background: #FFF;
-            padding: 25px;
-            border-radius: 25px;
-            width: 85%;
-            max-width: 320px;
-            text-align: center;
-            box-shadow: 0 10px 30px rgba(0,0,0,0.1);
-        }
-        .modal h3 { margin-bottom: 15px; color: var(--primary-dark); }
-        
-        .modal-input-group { margin-bottom: 15px; text-align: left; }
-        .modal label { display: block; font-size: 12px; color: var(--text-sub); margin-bottom: 5px; }
-        .modal input, .modal select {
-            width: 100%; padding: 10px; border: 2px solid #FBE9E7; border-radius: 12px;
-            font-size: 16px; color: var(--text-main); background: #FFFDFB;
-        }
-
-        .modal-actions { display: flex; gap: 10px; margin-top: 20px; }
-        .btn-cancel { background: #EFEBE9; color: var(--text-sub); }
-        .btn-save { background: var(--primary); color: white; }
-        .btn-modal { flex: 1; padding: 12px; border: none; border-radius: 15px; font-weight: bold; cursor: pointer; }
-
-        .feed-actions { display: flex; gap: 10px; margin-top: 10px; }
-        .feed-choice {
-            flex: 1;
-            padding: 12px;
-            border: none;
-            border-radius: 12px;
-            font-weight: 800;
-            color: #fff;
-            cursor: pointer;
-            box-shadow: 0 6px 14px rgba(0,0,0,0.08);
-        }
-        .feed-choice.l { background: #FFCC80; color: #6D4C41; }
-        .feed-choice.m { background: #FFB7B2; }
-        .feed-choice.h { background: #FF7043; }
-
-    </style>
-</head>
-<body>
-
-    <div id="alert-banner" style="display:none"></div>
-
-    <!-- Loading overlay -->
-    <div id="loadingOverlay" style="position:fixed; top:0; left:0; width:100%; height:100%; background:rgba(0,0,0,0.5); z-index:200; display:none; align-items:center; justify-content:center;">
-        <div style="background:#fff; padding:30px; border-radius:20px; text-align:center;">
-            <div style="font-size:40px; margin-bottom:10px;">⏳</div>
-            <div id="loadingText" style="color:#6D4C41; font-weight:bold;">Saving...</div>
-        </div>
-    </div>
-
-    <header>
-        <div>
-            <span class="kaomoji-header">(=^･ω･^=) Meow!</span>
-            <h1>Pet Feeder</h1>
-        </div>
-        <button class="settings-btn" onclick="openSettings()">⚙️</button>
-    </header>
-
-    <!-- Status Grid -->
-    <div class="status-grid">
-        <!-- Food Bowl -->
-        <div class="card">
-            <span class="card-icon">🥣</span>
-            <div class="card-label">Food Bowl</div>
-            <div class="card-value" id="val-food-bowl">--g</div>
-            <div class="card-chip" id="food-low-chip">LOW</div>
-        </div>
-        <!-- Water Bowl -->
-        <div class="card">
-            <span class="card-icon">💧</span>
-            <div class="card-label">Water Bowl</div>
-            <div class="card-value" id="val-water-bowl">--g</div>
-        </div>
-    </div>
-
-    <div class="quick-actions">
-        <button class="feed-btn" id="feedBtn" onclick="openFeedModal()">Feed Now</button>
-    </div>
-
-    <div class="section-title">
-        <span>📅</span> Feeding Schedule 
-        <span style="font-size:12px; color:var(--text-sub); margin-left:auto" id="schedule-count">0/8</span>
-    </div>
-    
-    <div id="schedule-container" class="schedule-list">
-        <!-- Items will be injected here -->
-    </div>
-
-    <button class="add-btn" id="addBtn" onclick="openModal()">+ Add Schedule</button>
-
-
-    <!-- Add Schedule Modal -->
-    <div class="modal-overlay" id="modalOverlay">
-        <div class="modal">
-            <h3>Add Feeding Time</h3>
-            <div class="modal-input-group">
-                <label>Time</label>
-                <input type="time" id="inputTime">
-            </div>
-            <div class="modal-input-group">
-                <label>Amount</label>
-                <select id="inputAmount">
-                    <option value="L">L (Little)</option>
-                    <option value="M">M (Normal)</option>
-                    <option value="H">H (Feast)</option>
-                </select>
-            </div>
-            <div class="modal-actions">
-                <button class="btn-modal btn-cancel" onclick="closeModal()">Cancel</button>
-                <button class="btn-modal btn-save" onclick="saveSchedule()">Save</button>
-            </div>
-        </div>
-    </div>
-
-    <!-- Feed Now Modal -->
-    <div class="modal-overlay" id="feedOverlay">
-        <div class="modal">
-            <h3>Manual Feed</h3>
-            <p style="color:var(--text-sub); margin-bottom:8px;">Pick a portion</p>
-            <div class="feed-actions">
-                <button class="feed-choice l" onclick="sendFeed('L')">L</button>
-                <button class="feed-choice m" onclick="sendFeed('M')">M</button>
-                <button class="feed-choice h" onclick="sendFeed('H')">H</button>
-            </div>
-            <div class="modal-actions" style="margin-top:14px;">
-                <button class="btn-modal btn-cancel" onclick="closeFeedModal()">Close</button>
-            </div>
-        </div>
-    </div>
-
-    <script>
-        // --- 1. DEVICE DATA ---
-        // Pulls from ESP32 mock API for now; swap to TM4C UART later.
-        let deviceData = {
-            foodBowl: 0,
-            waterBowl: 0,
-            timeWarn: false,
-            schedule: []
-        };
-        const FOOD_LOW_BADGE = 50;
-        const WATER_LOW = 80;
-
-        const MAX_SCHEDULES = 8;
-        const AMOUNT_LABEL = { L: "L · Small", M: "M · Mid", H: "H · High" };
-
-        function labelForAmount(code) {
-            const c = (code || "").toUpperCase();
-            return AMOUNT_LABEL[c] || c || "--";
-        }
-
-        // --- 2. UPDATE UI FUNCTIONS ---
-
-        function updateStatus() {
-            // Food Bowl
-            const foodVal = Math.min(999, Math.max(0, deviceData.foodBowl));
-            document.getElementById('val-food-bowl').textContent = foodVal + "g";
-            const lowChip = document.getElementById('food-low-chip');
-            lowChip.style.display = (foodVal < FOOD_LOW_BADGE) ? 'inline-flex' : 'none';
-
-            // Water Bowl
-            const wbEl = document.getElementById('val-water-bowl');
-            const waterVal = Math.min(999, Math.max(0, deviceData.waterBowl));
-            wbEl.textContent = waterVal + "g";
-            if(waterVal < WATER_LOW) {
-                wbEl.classList.add('is-alert');
-                wbEl.classList.remove('is-ok');
-            } else {
-                wbEl.classList.add('is-ok');
-                wbEl.classList.remove('is-alert');
-            }
+// ---------- Streaming JSON request bodies ----------
+// POST bodies arrive in chunks on the AsyncTCP task. Each chunk is run
+// through JsonStream as it arrives and the endpoint's upload struct keeps
+// only the fields it needs, in fixed storage; the body is never assembled.
+// The upload struct is malloc'd into request->_tempObject, which the
+// server free()s with the request, so it must stay trivially copyable.
+// Errors are latched on the first bad byte; the rest of the body is
+// skipped and the request handler answers 400/413.
+constexpr uint8_t JSON_STREAM_DEPTH = 4;
+constexpr size_t JSON_KEY_MAX = 8;
+constexpr size_t JSON_VALUE_MAX = 12;
+constexpr size_t SCHEDULE_BODY_MAX = 1024;
+constexpr size_t SCHEDULE_MAX_ITEMS = 8;  // TM4C SCHED_PARSE_MAX
+constexpr size_t TIME_BODY_MAX = 128;
+
+enum class JsonTok : uint8_t { OPEN_OBJECT, OPEN_ARRAY, CLOSE, STRING, NUMBER, LITERAL };
+
+struct JsonStream {
+    enum State : uint8_t { VALUE, KEY_OR_END, KEY, COLON, STRING, STRING_ESC, STRING_HEX, SCALAR, AFTER_VALUE, DONE, ERROR };
+
+    uint8_t state;
+    uint8_t depth;          // open containers; tokens report the level they sit at
+    uint8_t objects;        // bit n set: level n is an object
+    bool inKey;             // the string being read is a member name
+    bool emptyArray;        // '[' just opened, so ']' is allowed in VALUE
+    uint8_t hexLeft;
+    char key[JSON_KEY_MAX + 1];  // member name of the current value
+    uint8_t keyLen;
+    bool keyOverflow;
+    char value[JSON_VALUE_MAX + 1];  // string/number/literal text
+    uint8_t valueLen;
+    bool valueOverflow;
+
+    void begin() { memset(this, 0, sizeof(*this)); }
+    bool done() const { return state == DONE; }
+    bool failed() const { return state == ERROR; }
+    // Current member name; false inside arrays or for an overlong name
+    bool keyIs(const char *name) const {
+        return depth && (objects & (1u << (depth - 1))) && !keyOverflow && strcmp(key, name) == 0;
+    }
 
-            // Alerts summary
-            const alerts = [];
-            if (waterVal < WATER_LOW) alerts.push("Water bowl is LOW");
-            if (deviceData.timeWarn) alerts.push("Clock not synced");
-            const banner = document.getElementById('alert-banner');
-            if (alerts.length) {
-                banner.style.display = 'block';
-                banner.textContent = alerts.join(" · ");
-            } else {
-                banner.style.display = 'none';
-                banner.textContent = "";
+    // Feed bytes; h(JsonTok) is called for every token. Returns false once
+    // the input is not valid JSON.
+    template <typename Handler>
+    bool feed(const uint8_t *data, size_t len, Handler &h) {
+        for (size_t i = 0; i < len && state != ERROR; ++i) step(static_cast<char>(data[i]), h);
+        return state != ERROR;
+    }
+
+private:
+    template <typename Handler>
+    void step(char c, Handler &h) {
+        switch (state) {
+            case STRING:
+                if (c == '"') {
+                    if (inKey) {
+                        state = COLON;
+                    } else {
+                        h(JsonTok::STRING);
+                        afterValue();
+                    }
+                } else if (c == '\\') {
+                    state = STRING_ESC;
+                } else if (static_cast<uint8_t>(c) < 0x20) {
+                    state = ERROR;
+                } else {
+                    append(c);
+                }
+                return;
+            case STRING_ESC: {
+                static const char ESC_IN[] = "\"\\/bfnrt";
+                static const char ESC_OUT[] = "\"\\/\b\f\n\r\t";
+                const char *e = strchr(ESC_IN, c);
+                if (c == 'u') {
+                    append('?');  // not needed by any field we keep
+                    hexLeft = 4;
+                    state = STRING_HEX;
+                } else if (c && e) {
+                    append(ESC_OUT[e - ESC_IN]);
+                    state = STRING;
+                } else {
+                    state = ERROR;
+                }
+                return;
             }
+            case STRING_HEX:
+                if (!isxdigit(static_cast<unsigned char>(c))) state = ERROR;
+                else if (--hexLeft == 0) state = STRING;
+                return;
+            case SCALAR:
+                if (isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '+' || c == '.') {
+                    append(c);
+                    return;
+                }
+                endScalar(h);
+                if (state == ERROR) return;
+                break;  // c ends the scalar and is handled below
+            default:
+                break;
         }
 
-        function renderSchedule() {
-            const container = document.getElementById('schedule-container');
-            const btn = document.getElementById('addBtn');
-            const countLabel = document.getElementById('schedule-count');
-            
-            container.innerHTML = '';
-            
-            // Sort by time
-            deviceData.schedule.sort((a, b) => a.time.localeCompare(b.time));
-
-            deviceData.schedule.forEach((item, index) => {
-                const div = document.createElement('div');
-                div.className = 'schedule-item';
-                div.innerHTML = `
-                    <div style="display:flex; align-items:center">
-                        <span class="sch-time">${item.time}</span>
-                        <span class="sch-amount">${labelForAmount(item.amount)}</span>
-                    </div>
-                    <button class="del-btn" onclick="deleteSchedule(${index})">✕</button>
-                `;
-                container.appendChild(div);
-            });
-
-            // Update Counter
-            countLabel.textContent = `${deviceData.schedule.length}/${MAX_SCHEDULES}`;
-
-            // Disable button if full
-            if(deviceData.schedule.length >= MAX_SCHEDULES) {
-                btn.disabled = true;
-                btn.textContent = "Max 8 Reached";
-            } else {
-                btn.disabled = false;
-                btn.textContent = "+ Add Schedule";
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\n') return;
+        switch (state) {
+            case VALUE:
+                if (c == '{' || c == '[') {
+                    open(c == '{', h);
+                } else if (c == ']' && emptyArray) {
+                    close(h);
+                } else if (c == '"') {
+                    startString(false);
+                } else if (c == '-' || isalnum(static_cast<unsigned char>(c))) {
+                    valueLen = 0;
+                    valueOverflow = false;
+                    append(c);
+                    state = SCALAR;
+                } else {
+                    state = ERROR;
+                }
+                break;
+            case KEY_OR_END:
+            case KEY:
+                if (c == '"') startString(true);
+                else if (c == '}' && state == KEY_OR_END) close(h);
+                else state = ERROR;
+                break;
+            case COLON:
+                state = (c == ':') ? VALUE : ERROR;
+                break;
+            case AFTER_VALUE: {
+                const bool inObject = objects & (1u << (depth - 1));
+                if (c == ',') state = inObject ? KEY : VALUE;
+                else if (c == (inObject ? '}' : ']')) close(h);
+                else state = ERROR;
+                break;
             }
+            default:  // DONE: trailing data
+                state = ERROR;
+                break;
         }
+        emptyArray = emptyArray && state == VALUE;
+    }
 
-        // --- 3. ACTIONS ---
-
-        function openSettings() {
-            window.location.href = "/wifi";
+    template <typename Handler>
+    void open(bool object, Handler &h) {
+        if (depth >= JSON_STREAM_DEPTH) {
+            state = ERROR;
+            return;
         }
+        if (object) objects |= (1u << depth);
+        else objects &= ~(1u << depth);
+        depth++;
+        h(object ? JsonTok::OPEN_OBJECT : JsonTok::OPEN_ARRAY);
+        state = object ? KEY_OR_END : VALUE;
+        emptyArray = !object;
+    }
 
-        const feedModal = document.getElementById('feedOverlay');
+    template <typename Handler>
+    void close(Handler &h) {
+        depth--;
+        h(JsonTok::CLOSE);
+        afterValue();
+    }
 
-        function openFeedModal() {
-            feedModal.style.display = 'flex';
+    template <typename Handler>
+    void endScalar(Handler &h) {
+        value[valueLen] = '\0';
+        if (!strcmp(value, "true") || !strcmp(value, "false") || !strcmp(value, "null")) {
+            h(JsonTok::LITERAL);
+        } else {
+            // An overlong number is only checked for its first digit; the
+            // consumer sees valueOverflow
+            char *end = nullptr;
+            strtod(value, &end);
+            if (!isdigit(static_cast<unsigned char>(value[value[0] == '-'])) || (!valueOverflow && *end)) {
+                state = ERROR;
+                return;
+            }
+            h(JsonTok::NUMBER);
         }
+        afterValue();
+    }
 
-        function closeFeedModal() {
-            feedModal.style.display = 'none';
+    void startString(bool asKey) {
+        inKey = asKey;
+        if (asKey) {
+            keyLen = 0;
+            keyOverflow = false;
+            key[0] = '\0';
+        } else {
+            valueLen = 0;
+            valueOverflow = false;
+            value[0] = '\0';
         }
+        state = STRING;
+    }
 
-        async function sendFeed(level) {
-            closeFeedModal();
-            const btn = document.getElementById('feedBtn');
-            const prevText = btn.textContent;
-            btn.textContent = `Feeding ${level}...`;
-            btn.disabled = true;
-            try {
-                const body = new URLSearchParams();
-                body.append('level', level);
-                const res = await fetch('/api/feed_now', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/x-www-form-urlencoded' },
-                    body: body.toString()
-                });
-                if (!res.ok) {
-                    throw new Error(await res.text());
-                }
-                btn.textContent = `Fed (${level})`;
-                setTimeout(()=>{
-                    btn.textContent = 'Feed Now';
-                    btn.disabled = false;
-                }, 1500);
-            } catch (e) {
-                alert('Feed failed: ' + e.message);
-                btn.textContent = prevText;
-                btn.disabled = false;
+    void append(char c) {
+        if (state == STRING && inKey) {
+            if (keyLen < JSON_KEY_MAX) {
+                key[keyLen++] = c;
+                key[keyLen] = '\0';
+            } else {
+                keyOverflow = true;
             }
+        } else if (valueLen < JSON_VALUE_MAX) {
+            value[valueLen++] = c;
+            value[valueLen] = '\0';
+        } else {
+            valueOverflow = true;
         }
+    }
 
-        feedModal.addEventListener('click', (e)=>{
-            if (e.target === feedModal) closeFeedModal();
-        });
-
-        const cloneSchedule = () => deviceData.schedule.map(item => ({ time: item.time, amount: item.amount }));
-        const delay = (ms) => new Promise(resolve => setTimeout(resolve, ms));
-
-        function showLoading(text = 'Saving...') {
-            document.getElementById('loadingText').textContent = text;
-            document.getElementById('loadingOverlay').style.display = 'flex';
-        }
+    void afterValue() { state = depth ? AFTER_VALUE : DONE; }
+};
 
-        function hideLoading() {
-            document.getElementById('loadingOverlay').style.display = 'none';
-        }
+// Result of an upload once the body is complete: 0 = accepted
+struct UploadResult {
+    uint16_t code;
+    const char *error;
+};
 
-        async function deleteSchedule(index) {
-            if(confirm("Remove this feeding time?")) {
-                showLoading('Deleting...');
-                const prev = cloneSchedule();
-                deviceData.schedule.splice(index, 1);
-                renderSchedule();
-                const ok = await sendDataToESP(); // Sync
-                hideLoading();
-                if (!ok) {
-                    deviceData.schedule = prev;
-                    renderSchedule();
-                }
-            }
-        }
+// POST /api/schedule: [{"time":"HH:MM","amount":"L|M|H"},...]
+struct ScheduleUpload {
+    struct Item {
+        char time[JSON_VALUE_MAX + 1];
+        char amount;
+    };
 
-        // Modal Logic
-        const modal = document.getElementById('modalOverlay');
-        
-        function openModal() {
-            if(deviceData.schedule.length >= MAX_SCHEDULES) return;
-            // Default time to now
-            const now = new Date();
-            const timeStr = now.toTimeString().substring(0,5);
-            document.getElementById('inputTime').value = timeStr;
-            modal.style.display = 'flex';
-        }
+    JsonStream json;
+    UploadResult result;
+    Item items[SCHEDULE_MAX_ITEMS];
+    uint8_t count;
+    Item cur;
 
-        function closeModal() {
-            modal.style.display = 'none';
-        }
+    void begin(size_t total) {
+        memset(this, 0, sizeof(*this));
+        json.begin();
+        if (total > SCHEDULE_BODY_MAX) result = {413, "body too large"};
+    }
 
-        async function saveSchedule() {
-            const time = document.getElementById('inputTime').value;
-            const amount = document.getElementById('inputAmount').value.toUpperCase();
+    void feed(const uint8_t *data, size_t len) {
+        if (result.code) return;
+        if (!json.feed(data, len, *this) && !result.code) result = {400, "invalid JSON"};
+    }
 
-            if(!time) return;
+    UploadResult finish() {
+        if (!result.code && !json.done()) result = {400, "incomplete JSON"};
+        return result;
+    }
 
-            // --- Check for Duplicates ---
-            // Frontend check to prevent same time
-            const exists = deviceData.schedule.some(item => item.time === time);
-            if (exists) {
-                alert("This time is already scheduled! \nPlease choose a different time. (=^･ω･^=)");
+    // Token handler for JsonStream
+    void operator()(JsonTok tok) {
+        if (result.code) return;
+        const uint8_t depth = json.depth;
+        if (depth == 1 && tok == JsonTok::OPEN_ARRAY) return;
+        if (depth == 0 && tok == JsonTok::CLOSE) return;
+        if (depth == 2 && tok == JsonTok::OPEN_OBJECT) {
+            memset(&cur, 0, sizeof(cur));
+            return;
+        }
+        if (depth == 1 && tok == JsonTok::CLOSE) {
+            // Entries without a time or with an unknown amount are skipped
+            if (!cur.time[0] || !cur.amount) return;
+            if (count >= SCHEDULE_MAX_ITEMS) {
+                result = {413, "too many entries"};
                 return;
             }
-
-            closeModal();
-            showLoading('Saving schedule...');
-            const prev = cloneSchedule();
-            deviceData.schedule.push({ time, amount });
-            renderSchedule();
-            const ok = await sendDataToESP(); // Sync
-            hideLoading();
-            if (!ok) {
-                deviceData.schedule = prev;
-                renderSchedule();
+            items[count++] = cur;
+            return;
+        }
+        if (depth == 2 && tok == JsonTok::STRING) {
+            if (json.keyIs("time")) {
+                if (json.valueOverflow) result = {400, "invalid time"};
+                else memcpy(cur.time, json.value, sizeof(cur.time));
+            } else if (json.keyIs("amount")) {
+                cur.amount = Tm4cLink::amountCode(json.value);
             }
+            return;
         }
+        // Other members of an entry are ignored
+        if (depth > 2 || (depth == 2 && tok != JsonTok::OPEN_ARRAY)) return;
+        result = {400, "expected an array of objects"};
+    }
+};
 
-        // --- 4. DATA SYNC (Simulated) ---
-        async function loadStatus() {
-            const res = await fetch('/api/status');
-            const json = await res.json();
-            deviceData.foodBowl = Math.min(999, Math.max(0, json.foodBowl ?? deviceData.foodBowl));
-            deviceData.waterBowl = Math.min(999, Math.max(0, json.waterBowl ?? deviceData.waterBowl));
-            deviceData.timeWarn = !!json.timeWarn;
-        }
-
-        async function loadSchedule() {
-            const res = await fetch('/api/schedule');
-            const list = await res.json();
-            deviceData.schedule = Array.isArray(list) ? list.map(item => ({
-                time: item.time || "",
-                amount: (item.amount || '').toUpperCase()
-            })) : [];
-        }
-
-        async function sendDataToESP() {
-            const payload = JSON.stringify(deviceData.schedule);
-            try {
-                // Send schedule update request (returns immediately)
-                const res = await fetch('/api/schedule', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' },
-                    body: payload
-                });
-                if (!res.ok) throw new Error('Request failed');
-
-                console.log('Schedule update queued, polling for status...');
-
-                // Poll for completion
-                const maxPollTime = 35000; // 35 seconds
-                const pollInterval = 500;  // 500ms
-                const startTime = Date.now();
-
-                while (Date.now() - startTime < maxPollTime) {
-                    await delay(pollInterval);
-
-                    const statusRes = await fetch('/api/schedule_status');
-                    if (!statusRes.ok) throw new Error('Status check failed');
-
-                    const status = await statusRes.json();
-                    console.log('Schedule status:', status);
-
-                    if (status.status === 'success') {
-                        console.log('Schedule update SUCCESS');
-                        // Clear the task status
-                        await fetch('/api/schedule_status?clear=1');
-                        // Refresh schedule display
-                        await loadSchedule();
-                        renderSchedule();
-                        return true;
-                    } else if (status.status === 'failed') {
-                        const errMsg = status.error || 'Unknown error';
-                        // Clear the task status
-                        await fetch('/api/schedule_status?clear=1');
-                        throw new Error(errMsg);
-                    } else if (status.status === 'processing') {
-                        const retry = status.retry || 0;
-                        console.log(`Processing... retry ${retry}`);
-                        // Update loading text to show progress
-                        const elapsed = Math.floor((Date.now() - startTime) / 1000);
-                        showLoading(`Syncing... (retry ${retry}, ${elapsed}s)`);
-                    }
-                    // Continue polling if pending or processing
-                }
+// POST /api/set_time: {"unix":<seconds>}
+struct TimeUpload {
+    JsonStream json;
+    UploadResult result;
+    uint32_t unixTs;
+    bool haveUnix;
+
+    void begin(size_t total) {
+        memset(this, 0, sizeof(*this));
+        json.begin();
+        if (total > TIME_BODY_MAX) result = {413, "body too large"};
+    }
 
-                throw new Error('Timeout - device may be offline');
+    void feed(const uint8_t *data, size_t len) {
+        if (result.code) return;
+        if (!json.feed(data, len, *this) && !result.code) result = {400, "invalid JSON"};
+    }
 
-            } catch (e) {
-                console.error('Schedule sync failed:', e);
-                alert(`计划保存失败: ${e.message}\n请重试 (=^･ω･^=)`);
-                await loadSchedule();
-                renderSchedule();
-                return false;
-            }
-        }
+    UploadResult finish() {
+        if (!result.code && !json.done()) result = {400, "incomplete JSON"};
+        if (!result.code && !haveUnix) result = {400, "unix required"};
+        return result;
+    }
 
-        let statusTimer = null;
-        function startStatusTimer() {
-            if (statusTimer) return;
-            statusTimer = setInterval(async ()=>{
-                try { await loadStatus(); updateStatus(); } catch(e){ console.warn('Status poll failed', e); }
-            }, 5000);  // Reduced polling from 3s to 5s
-        }
-        function stopStatusTimer() {
-            if (statusTimer) {
-                clearInterval(statusTimer);
-                statusTimer = null;
-            }
+    void operator()(JsonTok tok) {
+        if (result.code) return;
+        const uint8_t depth = json.depth;
+        if (depth == 1 && tok == JsonTok::OPEN_OBJECT) return;
+        if (depth == 0) {
+            if (tok != JsonTok::CLOSE) result = {400, "expected an object"};
+            return;
         }
-
-        async function onVisibleRefresh() {
-            try {
-                await Promise.all([loadStatus(), loadSchedule()]);
-                updateStatus();
-                renderSchedule();
-            } catch (e) {
-                console.warn('Visible refresh failed', e);
+        if (depth == 1 && json.keyIs("unix")) {
+            char *end = nullptr;
+            const unsigned long v = strtoul(json.value, &end, 10);
+            if (tok != JsonTok::NUMBER || json.valueOverflow || json.value[0] == '-' || *end || v > UINT32_MAX) {
+                result = {400, "invalid unix"};
+                return;
             }
+            unixTs = static_cast<uint32_t>(v);
+            haveUnix = true;
         }
+    }
+};
 
-        // Initialize
-        window.onload = async function() {
-            await onVisibleRefresh();
-            startStatusTimer();
-        };
+// Body callback shared by the streaming uploads
+template <typename Upload>
+void uploadChunk(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+    auto *up = static_cast<Upload *>(request->_tempObject);
+    if (index == 0 && !up) {
+        up = static_cast<Upload *>(malloc(sizeof(Upload)));
+        if (!up) return;  // uploadFinish() then answers 400
+        up->begin(total);
+        request->_tempObject = up;
+    }
+    if (up) up->feed(data, len);
+}
 
-        document.addEventListener('visibilitychange', async ()=>{
-            if (document.visibilityState === 'visible') {
-                await onVisibleRefresh();
-                startStatusTimer();
-            } else {
-                stopStatusTimer();
-            }
-        });
+// Answers the error and returns null unless the upload was accepted
+template <typename Upload>
+Upload *uploadFinish(AsyncWebServerRequest *request) {
+    auto *up = static_cast<Upload *>(request->_tempObject);
+    const UploadResult r = up ? up->finish() : UploadResult{400, "empty body"};
+    if (r.code) {
+        request->send(r.code, "text/plain", r.error);
+        return nullptr;
+    }
+    return up;
+}
 
-    </script>
-</body>
-</html>
-)HTML";
+// ---------- Web routes ----------
+// Pages and their scripts/styles are precompressed into web_assets.h and
+// sent as stored. Pages are revalidated with their ETag (304 when
+// unchanged); versioned assets have the hash in their URL and are cached
+// for a year.
+void sendAsset(AsyncWebServerRequest *request, const WebAsset &asset) {
+    const char *cacheControl = asset.immutable ? "public, max-age=31536000, immutable" : "no-cache";
+    AsyncWebHeader *inm = request->getHeader("If-None-Match");
+    AsyncWebServerResponse *response;
+    if (inm && inm->value() == asset.etag) {
+        response = request->beginResponse(304);
+    } else {
+        response = request->beginResponse_P(200, asset.type, asset.gz, asset.gzLen);
+        response->addHeader("Content-Encoding", "gzip");
+    }
+    response->addHeader("ETag", asset.etag);
+    response->addHeader("Cache-Control", cacheControl);
+    request->send(response);
+}
 
 void registerWebHandlers() {
     server.on("/", HTTP_GET, [](AsyncWebServerRequest *request) {
         if (WiFi.status() == WL_CONNECTED) {
             Serial.println("[HTTP] GET / -> HOME_PAGE");
-            request->send(200, "text/html", HOME_PAGE);
+            sendAsset(request, WEB_HOME_PAGE);
         } else {
             Serial.println("[HTTP] GET / -> CONFIG_PAGE");
-            request->send(200, "text/html", CONFIG_PAGE);
+            sendAsset(request, WEB_CONFIG_PAGE);
         }
     });
 
     server.on("/wifi", HTTP_GET, [](AsyncWebServerRequest *request) {
         Serial.println("[HTTP] GET /wifi");
-        request->send(200, "text/html", CONFIG_PAGE);
+        sendAsset(request, WEB_CONFIG_PAGE);
     });
 
-    // ---- API: backed by TM4C UART JSON line ----
+    for (const WebAsset *asset : WEB_VERSIONED_ASSETS) {
+        server.on(asset->path, HTTP_GET, [asset](AsyncWebServerRequest *request) { sendAsset(request, *asset); });
+    }
+
+    // ---- API: served from the TM4C cache, refreshed in loop() ----
     server.on("/api/status", HTTP_GET, [](AsyncWebServerRequest *request) {
-        String err;
-        if (tm4c.getStatus(statusData, err)) {
-            String payload = statusToJson();
-            request->send(200, "application/json", payload);
-        } else {
-            Serial.printf("[UART] get_status fail: %s\n", err.c_str());
-            request->send(500, "text/plain", err);
+        lastWebPollMs = millis();
+        if (!statusCached) {
+            request->send(503, "text/plain", "status not available yet");
+            return;
+        }
+        sendJson(request, [](JsonWriter &w) { writeStatus(w, true); });
+    });
+
+    server.on("/api/snapshot", HTTP_GET, [](AsyncWebServerRequest *request) {
+        lastWebPollMs = millis();
+        if (!statusCached || !scheduleCached) {
+            request->send(503, "text/plain", "snapshot not available yet");
+            return;
         }
+        sendJson(request, writeSnapshot);
     });
 
     server.on("/api/tz", HTTP_GET, [](AsyncWebServerRequest *request) {
-        String payload = "{\"tzOffset\":" + String(timezoneOffsetSeconds) + "}";
-        request->send(200, "application/json", payload);
+        sendJson(request, [](JsonWriter &w) {
+            w.beginObject();
+            w.member("tzOffset", timezoneOffsetSeconds);
+            w.endObject();
+        });
     });
 
     server.on("/api/schedule", HTTP_GET, [](AsyncWebServerRequest *request) {
-        String err;
-        if (tm4c.getSchedule(scheduleData, err)) {
-            String payload = scheduleToJson();
-            request->send(200, "application/json", payload);
-        } else {
-            Serial.printf("[UART] get_schedule fail: %s\n", err.c_str());
-            request->send(500, "text/plain", err);
+        lastWebPollMs = millis();
+        if (!scheduleCached) {
+            request->send(503, "text/plain", "schedule not available yet");
+            return;
         }
+        sendJson(request, writeScheduleResponse);
     });
 
     server.on("/api/schedule_status", HTTP_GET, [](AsyncWebServerRequest *request) {
         // Check if client wants to acknowledge/clear the result
         bool shouldClear = request->hasParam("clear");
-
-        String status;
-        switch (scheduleTask.state) {
-            case ScheduleTaskState::IDLE:
-                status = "idle";
-                break;
-            case ScheduleTaskState::PENDING:
-                status = "pending";
-                break;
-            case ScheduleTaskState::PROCESSING:
-                status = "processing";
-                break;
-            case ScheduleTaskState::SUCCESS:
-                status = "success";
-                break;
-            case ScheduleTaskState::FAILED:
-                status = "failed";
-                break;
-        }
-        String payload = "{\"status\":\"" + status + "\"";
-        if (scheduleTask.state == ScheduleTaskState::FAILED && scheduleTask.errorMessage.length()) {
-            payload += ",\"error\":\"" + scheduleTask.errorMessage + "\"";
-        }
-        if (scheduleTask.state == ScheduleTaskState::PROCESSING) {
-            payload += ",\"retry\":" + String(scheduleTask.retryCount);
-        }
-        payload += "}";
-        request->send(200, "application/json", payload);
+        sendJson(request, writeScheduleTask);
 
         // Clear state after client acknowledges
-        if (shouldClear && (scheduleTask.state == ScheduleTaskState::SUCCESS ||
-                           scheduleTask.state == ScheduleTaskState::FAILED)) {
-            scheduleTask.state = ScheduleTaskState::IDLE;
+        if (shouldClear) {
+            CacheLock lock;
+            if (scheduleTask.state == ScheduleTaskState::SUCCESS || scheduleTask.state == ScheduleTaskState::FAILED) {
+                scheduleTask.state = ScheduleTaskState::IDLE;
+            }
         }
     });
 
-    static String scheduleBody;
+    // The body is parsed chunk by chunk (uploadChunk); the handler runs once
+    // it is complete
     server.on("/api/schedule", HTTP_POST,
               [](AsyncWebServerRequest *request) {
-                  // Immediate response - processing will happen in background
-                  request->send(202, "application/json", "{\"status\":\"accepted\"}");
-              },
-              nullptr,
-              [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
-                  if (index == 0) {
-                      scheduleBody = "";
-                      scheduleBody.reserve(total + 1);
-                  }
-                  scheduleBody.concat((const char *) data, len);
-                  if (index + len != total) return;
-
-                  JsonDocument doc;
-                  DeserializationError err = deserializeJson(doc, scheduleBody);
-                  if (err || !doc.is<JsonArray>()) {
-                      Serial.printf("[Async] set_schedule parse error: %s\n", err.c_str());
-                      scheduleTask.state = ScheduleTaskState::FAILED;
-                      scheduleTask.errorMessage = "Invalid JSON";
-                      return;
-                  }
+                  ScheduleUpload *up = uploadFinish<ScheduleUpload>(request);
+                  if (!up) return;
 
-                  // Parse schedule and queue it for background processing
-                  scheduleTask.pendingSchedule.clear();
-                  for (JsonObject obj: doc.as<JsonArray>()) {
-                      const char *time = obj["time"] | "";
-                      const char *amount = obj["amount"] | "";
-                      String amountCode = Tm4cLink::amountToCode(String(amount));
-                      if (strlen(time) == 0 || amountCode.length() == 0) continue;
-                      scheduleTask.pendingSchedule.push_back({String(time), amountCode});
+                  // Queue for background processing
+                  std::vector<ScheduleItem> items;
+                  for (uint8_t i = 0; i < up->count; ++i) {
+                      items.push_back({String(up->items[i].time), String(up->items[i].amount)});
                   }
 
                   // Mark task as pending - will be processed in loop()
-                  scheduleTask.state = ScheduleTaskState::PENDING;
-                  scheduleTask.errorMessage = "";
-                  scheduleTask.retryCount = 0;
-                  scheduleTask.startMs = millis();
-                  Serial.printf("[Async] Schedule update queued: %d items\n", scheduleTask.pendingSchedule.size());
-              });
+                  {
+                      CacheLock lock;
+                      scheduleTask.pendingSchedule = std::move(items);
+                      scheduleTask.state = ScheduleTaskState::PENDING;
+                      scheduleTask.errorMessage = "";
+                      scheduleTask.retryCount = 0;
+                      scheduleTask.startMs = millis();
+                  }
+                  Serial.printf("[Async] Schedule update queued: %u items\n", static_cast<unsigned>(up->count));
+                  // Immediate response - processing will happen in background
+                  request->send(202, "application/json", "{\"status\":\"accepted\"}");
+              },
+              nullptr, uploadChunk<ScheduleUpload>);
 
     server.on("/api/set_time", HTTP_POST,
               [](AsyncWebServerRequest *request) {
+                  TimeUpload *up = uploadFinish<TimeUpload>(request);
+                  if (!up) return;
+                  const uint32_t unixTs = up->unixTs;
+                  // Report the TM4C's answer; a sync still queued at the
+                  // timeout is cancelled, so "link busy" means not applied
+                  String err;
+                  bool ok = linkCall(LinkPrio::NORMAL, "set_time",
+                                     [unixTs](String &e) { return tm4c.timeSync(unixTs, timezoneOffsetSeconds, e); },
+                                     err, SET_TIME_CALL_TIMEOUT_MS);
+                  if (!ok) {
+                      Serial.printf("[UART] set_time fail: %s\n", err.c_str());
+                      request->send(err == "link busy" ? 503 : 500, "text/plain", err);
+                      return;
+                  }
+                  Serial.printf("[UART] set_time ok -> ts=%lu tz=%d\n", (unsigned long) unixTs, timezoneOffsetSeconds);
                   request->send(200, "application/json", "{\"ok\":true}");
               },
-              nullptr,
-              [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
-                  static String timeBody;
-                  if (index == 0) {
-                      timeBody = "";
-                      timeBody.reserve(total + 1);
-                  }
-                  timeBody.concat((const char *) data, len);
-                  if (index + len == total) {
-                      JsonDocument doc;
-                      DeserializationError errJson = deserializeJson(doc, timeBody);
-                      if (errJson) {
-                          Serial.printf("[UART] set_time parse error: %s\n", errJson.c_str());
-                          return;
-                      }
-                      uint32_t unixTs = doc["unix"] | 0;
-                      String err;
-                      if (!tm4c.timeSync(unixTs, timezoneOffsetSeconds, err)) {
-                          Serial.printf("[UART] set_time fail: %s\n", err.c_str());
-                      } else {
-                          Serial.printf("[UART] set_time ok -> ts=%lu tz=%d\n", (unsigned long) unixTs, timezoneOffsetSeconds);
-                      }
-                  }
-              });
+              nullptr, uploadChunk<TimeUpload>);
 
     server.on("/api/feed_now", HTTP_POST, [](AsyncWebServerRequest *request) {
         if (!request->hasParam("level", true)) {
@@ -1852,28 +2977,135 @@ void registerWebHandlers() {
         if (level.length() > 1) level = level.substring(0, 1);
         level.toUpperCase();
         String err;
-        if (tm4c.feedNow(level, err)) {
+        bool ok = linkCall(LinkPrio::URGENT, "feed", [level](String &e) { return tm4c.feedNow(level, e); }, err);
+        if (ok) {
             request->send(200, "application/json", "{\"ok\":true}");
         } else {
-            int code = (err == "invalid level") ? 400 : 500;
+            // "link busy": the feed was cancelled before reaching the TM4C, so a retry is safe
+            int code = (err == "invalid level") ? 400 : (err == "link busy") ? 503 : 500;
             request->send(code, "text/plain", err);
         }
     });
 
+    server.on("/api/link_stats", HTTP_GET, [](AsyncWebServerRequest *request) {
+        AsyncResponseStream *response = request->beginResponseStream("application/json");
+        JsonWriter w(*response);
+        w.beginObject();
+        w.key("queries");
+        w.beginObject();
+        xSemaphoreTake(linkQueueMutex, portMAX_DELAY);
+        for (size_t i = 0; i < static_cast<size_t>(LinkQueryId::COUNT); ++i) {
+            const LinkFlight &f = linkFlights[i];
+            w.key(LINK_QUERY_NAMES[i]);
+            w.beginObject();
+            w.member("issued", f.issued);
+            w.member("coalesced", f.coalesced);
+            w.member("pending", f.pending);
+            w.endObject();
+        }
+        w.endObject();
+        w.key("queued");
+        w.beginArray();
+        for (size_t p = 0; p < static_cast<size_t>(LinkPrio::COUNT); ++p) {
+            w.value(static_cast<uint32_t>(linkQueues[p].size()));
+        }
+        xSemaphoreGive(linkQueueMutex);
+        w.endArray();
+        w.endObject();
+        request->send(response);
+    });
+
+    // Display cost per frame; compare last_bytes with full_frame_bytes.
+    // ?qr_bench times the QR drawing on the next QR page render; poll
+    // without it for qr_module_us and qr_blit_us.
+    server.on("/api/ui_stats", HTTP_GET, [](AsyncWebServerRequest *request) {
+        if (request->hasParam("qr_bench")) qrBenchRequested = true;
+        AsyncResponseStream *response = request->beginResponseStream("application/json");
+        JsonWriter w(*response);
+        w.beginObject();
+        w.member("frames", uiStats.frames);
+        w.member("page_clears", uiStats.pageClears);
+        w.member("last_widgets", uiStats.lastWidgets);
+        w.member("last_bytes", uiStats.lastBytes);
+        w.member("avg_bytes", uiStats.frames ? static_cast<uint32_t>(uiStats.totalBytes / uiStats.frames) : 0u);
+        w.member("full_frame_bytes", static_cast<uint32_t>(tft.width() * tft.height() * 2));
+        w.member("last_us", uiStats.lastUs);
+        w.member("max_us", uiStats.maxUs);
+        w.member("sprite", uiBandOk);
+        w.member("qr_modules", uiStats.qrModules);
+        w.member("qr_module_us", uiStats.qrModuleUs);
+        w.member("qr_blit_us", uiStats.qrBlitUs);
+        w.member("qr_draw_us", uiStats.qrDrawUs);
+        w.endObject();
+        request->send(response);
+    });
+
+    // Heap health for load tests: compare min_free and the block counts
+    // before and after a burst of requests
+    server.on("/api/heap", HTTP_GET, [](AsyncWebServerRequest *request) {
+        multi_heap_info_t info;
+        heap_caps_get_info(&info, MALLOC_CAP_8BIT);
+        AsyncResponseStream *response = request->beginResponseStream("application/json");
+        JsonWriter w(*response);
+        w.beginObject();
+        w.member("free", info.total_free_bytes);
+        w.member("min_free", info.minimum_free_bytes);
+        w.member("largest_free", info.largest_free_block);
+        w.member("allocated_blocks", info.allocated_blocks);
+        w.member("free_blocks", info.free_blocks);
+        w.member("uptime_ms", millis());
+        w.endObject();
+        request->send(response);
+    });
+
+    server.on("/api/link_bench", HTTP_GET, [](AsyncWebServerRequest *request) {
+        // ?run starts a benchmark in loop(); poll without it for the result
+        bool run = request->hasParam("run");
+        sendJson(request, [run](JsonWriter &w) {
+            if (run && !linkBench.running) linkBench.requested = true;
+            const LinkBench &b = linkBench;
+            w.beginObject();
+            w.member("running", b.running || b.requested);
+            if (b.valid) {
+                w.member("rounds", LINK_BENCH_ROUNDS);
+                w.member("bytes", b.bytes);
+                w.key("paced");
+                w.beginObject();
+                w.member("avg_ms", b.pacedTotalMs / LINK_BENCH_ROUNDS);
+                w.member("max_ms", b.pacedMaxMs);
+                w.member("ok", b.pacedOk);
+                w.endObject();
+                w.key("line_rate");
+                w.beginObject();
+                w.member("avg_ms", b.lineTotalMs / LINK_BENCH_ROUNDS);
+                w.member("max_ms", b.lineMaxMs);
+                w.member("ok", b.lineOk);
+                w.endObject();
+                w.key("echo");
+                w.beginArray();
+                for (const LinkEchoResult &e : b.echo) {
+                    w.beginObject();
+                    w.member("baud", e.baud);
+                    w.member("ok", e.ok);
+                    w.member("rtt_us", e.rttUs);
+                    w.member("bytes_per_s", e.bytesPerSec);
+                    w.endObject();
+                }
+                w.endArray();
+            }
+            w.endObject();
+        });
+    });
+
     server.on("/scan", HTTP_GET, [](AsyncWebServerRequest *request) {
         // Mark request; actual scan starts in loop to avoid blocking HTTP task.
         scanRequested = true;
-        if (!cachedSsids.empty()) {
-            String json = "[";
-            for (size_t i = 0; i < cachedSsids.size(); ++i) {
-                if (i) json += ",";
-                json += "\"" + cachedSsids[i] + "\"";
-            }
-            json += "]";
-            request->send(200, "application/json", json);
-        } else {
-            request->send(200, "application/json", "[]");
-        }
+        AsyncResponseStream *response = request->beginResponseStream("application/json");
+        JsonWriter w(*response);
+        w.beginArray();
+        for (const String &ssid : cachedSsids) w.value(ssid);  // escaped: SSIDs may hold '"' or '\\'
+        w.endArray();
+        request->send(response);
     });
 
     server.on("/configure", HTTP_POST, [](AsyncWebServerRequest *request) {
@@ -1947,9 +3179,13 @@ void onWiFiEvent(WiFiEvent_t event, WiFiEventInfo_t info) {
 // ---------- Setup & Loop ----------
 void setup() {
     Serial.begin(115200);
-    tm4c.begin();
+    cacheMutex = xSemaphoreCreateMutex();
+    pushMutex = xSemaphoreCreateMutex();
+    linkBegin();
+    linkSubmit(LinkPrio::NORMAL, "baud", [](String &) { return tm4c.negotiateBaud(UART_FAST_BAUD); });
     tft.init();
     tft.setRotation(0);
+    uiBegin();
     tft.fillScreen(COLOR_BG);
     tft.setTextDatum(TC_DATUM);
     tft.setTextColor(COLOR_TEXT, COLOR_BG);
@@ -1962,9 +3198,10 @@ void setup() {
     WiFi.onEvent(onWiFiEvent);
     tryConnectStored();
     // Initial fetch to populate display/cache
-    fetchStatusOnce();
-    fetchScheduleOnce();
+    fetchSnapshotOnce();
     registerWebHandlers();
+    ws.onEvent(onWsEvent);
+    server.addHandler(&ws);
     server.begin();
 
     Serial.printf("AP SSID: %s  PASS: %s\n", AP_SSID, AP_PASSWORD);
@@ -1972,53 +3209,57 @@ void setup() {
 
 void loop() {
     const uint32_t nowMs = millis();
-    tm4c.poll();  // handle asynchronous AT+GETTIME
 
-    // Process async schedule update task
-    if (scheduleTask.state == ScheduleTaskState::PENDING) {
-        scheduleTask.state = ScheduleTaskState::PROCESSING;
-        Serial.println("[Async] Starting schedule update task");
+    // Hand a queued schedule update to the link task; the job owns its items
+    {
+        std::vector<ScheduleItem> items;
+        uint32_t startMs = 0;
+        bool start = false;
+        {
+            CacheLock lock;
+            if (scheduleTask.state == ScheduleTaskState::PENDING) {
+                scheduleTask.state = ScheduleTaskState::PROCESSING;
+                items.swap(scheduleTask.pendingSchedule);
+                startMs = scheduleTask.startMs;
+                start = true;
+            }
+        }
+        if (start) {
+            Serial.println("[Async] Starting schedule update task");
+            linkSubmit(LinkPrio::NORMAL, "schedule_update", [items, startMs](String &err) {
+                return runScheduleTask(items, startMs, err);
+            });
+        }
     }
 
-    if (scheduleTask.state == ScheduleTaskState::PROCESSING) {
-        const int MAX_RETRIES = 5;  // Reduced from 10
-        const uint32_t TASK_TIMEOUT_MS = 30000;  // 30 seconds total timeout
-
-        // Check timeout
-        if (nowMs - scheduleTask.startMs > TASK_TIMEOUT_MS) {
-            scheduleTask.state = ScheduleTaskState::FAILED;
-            scheduleTask.errorMessage = "Timeout after " + String(scheduleTask.retryCount) + " retries";
-            Serial.printf("[Async] Schedule update timeout after %d retries\n", scheduleTask.retryCount);
-        } else {
-            // Try to send schedule
-            String err;
-            bool slowMode = scheduleTask.retryCount > 0;  // Use slow mode after first failure
-            bool ok = tm4c.setSchedule(scheduleTask.pendingSchedule, err, slowMode);
-
-            if (ok) {
-                // Success!
-                scheduleData = scheduleTask.pendingSchedule;
-                scheduleTask.state = ScheduleTaskState::SUCCESS;
-                scheduleTask.errorMessage = "";
-                displayDirty = true;
-                Serial.printf("[Async] Schedule update SUCCESS after %d attempts\n", scheduleTask.retryCount + 1);
-            } else {
-                // Failed, check if we should retry
-                scheduleTask.retryCount++;
-                Serial.printf("[Async] Schedule update retry %d/%d failed: %s\n",
-                             scheduleTask.retryCount, MAX_RETRIES, err.c_str());
-
-                if (scheduleTask.retryCount >= MAX_RETRIES) {
-                    scheduleTask.state = ScheduleTaskState::FAILED;
-                    scheduleTask.errorMessage = err.length() ? err : "Failed after retries";
-                    Serial.printf("[Async] Schedule update FAILED: %s\n", scheduleTask.errorMessage.c_str());
-                } else {
-                    // Wait before next retry (non-blocking in next loop iteration)
-                    delay(200);  // Small delay, but won't block for long
-                }
-            }
+    // Retry the fast link rate after a fallback
+    if (tm4c.baud != UART_FAST_BAUD && nowMs - tm4c.lastBaudAttemptMs > BAUD_RETRY_MS) {
+        tm4c.lastBaudAttemptMs = nowMs;  // negotiateBaud stamps it again when it runs
+        linkSubmit(LinkPrio::BACKGROUND, "baud", [](String &) { return tm4c.negotiateBaud(UART_FAST_BAUD); });
+    }
+
+    // Link benchmark (triggered by /api/link_bench?run); queued behind any schedule update
+    bool benchStart = false;
+    {
+        CacheLock lock;
+        if (linkBench.requested) {
+            linkBench.requested = false;
+            linkBench.running = true;
+            benchStart = true;
         }
     }
+    if (benchStart) {
+        linkSubmit(LinkPrio::BACKGROUND, "link_bench", [](String &) {
+            runLinkBench();
+            return true;
+        });
+    }
+
+    // QR bench (/api/ui_stats?qr_bench): redraw the QR page if it is showing
+    if (qrBenchRequested && displayMode == DisplayMode::QR) {
+        uiQrKey = 0;  // uiKeyf() never returns 0, so drawQr runs and takes the bench
+        drawCurrentQrStage();
+    }
 
     // Start scan synchronously if requested (triggered by /scan), in loop to avoid blocking HTTP task.
     if (scanRequested) {
@@ -2069,11 +3310,27 @@ void loop() {
         lastDisplayMode = displayMode;
     }
 
-    // Status polling only while on status page (reduced from 3s to 5s)
-    if (statusPollActive && nowMs - lastStatusPollMs > 5000) {
+    // Keep the HTTP cache warm while the status page is shown or a browser
+    // asked recently; AT+STATUS2?<gen> makes an unchanged poll cheap
+    const bool webActive = (lastWebPollMs && nowMs - lastWebPollMs < WEB_ACTIVE_MS) || ws.count() > 0;
+    bool feeding;
+    {
+        CacheLock lock;
+        feeding = statusData.busy;
+    }
+    const uint32_t statusRefreshMs = feeding ? FEED_REFRESH_MS : STATUS_REFRESH_MS;
+    if ((statusPollActive || webActive) && nowMs - lastStatusPollMs > statusRefreshMs) {
         lastStatusPollMs = nowMs;
         fetchStatusOnce();
     }
+    if (webActive && nowMs - scheduleFetchedMs > SCHEDULE_REFRESH_MS) {
+        bool uploading;
+        {
+            CacheLock lock;
+            uploading = scheduleTask.state == ScheduleTaskState::PROCESSING;
+        }
+        if (!uploading) fetchScheduleOnce();
+    }
 
     // Schedule fetch when entering schedule page
     if (displayMode == DisplayMode::DASH_SCHEDULE && scheduleNeedsFetch) {
@@ -2089,17 +3346,22 @@ void loop() {
         }
     }
 
-    // Refresh dashboards when marked dirty
-    if (displayDirty && displayMode != DisplayMode::QR) {
-        renderCurrentDisplay();
+    // Push whatever changed to the WebSocket clients
+    pushState();
+    pushFlush();
+
+    // A new minute or time warning on a page with the status bar
+    wallClock.poll();
+    const bool minuteChanged = wallClock.takeMinuteEvent();
+    if ((displayMode != DisplayMode::QR || currentStage == Stage::ONLINE) &&
+        (minuteChanged || lastClockWarn != timeDesyncWarning)) {
+        displayDirty = true;
     }
 
-    // Refresh QR screen time display while online
-    if (displayMode == DisplayMode::QR && currentStage == Stage::ONLINE) {
-        String nowStr = currentTimeString();
-        if (nowStr != lastQrTimeShown || lastQrTimeWarn != timeDesyncWarning) {
-            renderCurrentDisplay();
-        }
+    // Only the widgets whose content changed are repainted
+    if (displayDirty) {
+        renderCurrentDisplay();
+        displayDirty = false;
     }
 
     delay(20);
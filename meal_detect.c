@@ -0,0 +1,107 @@
+#include "meal_detect.h"
+
+#include <string.h>
+
+void meal_detect_init(meal_detect_t *md)
+{
+    memset(md, 0, sizeof(*md));
+    md->state = MEAL_ST_INIT;
+}
+
+static void restart(meal_detect_t *md, meal_state_t state)
+{
+    md->state = state;
+    md->settle = MEAL_SETTLE_SAMPLES;
+    md->cusum = 0.0f;
+    md->acc = 0.0f;
+}
+
+// Close the current session; true if it was large enough to report
+static bool finish(meal_detect_t *md, meal_session_t *out)
+{
+    float eaten = md->ref - md->min;
+    bool valid = (eaten >= MEAL_MIN_GRAMS && eaten <= MEAL_MAX_GRAMS);
+    if (valid && out) {
+        out->start_ms = md->start_ms;
+        out->end_ms = md->last_drop_ms;
+        out->grams = eaten;
+    }
+    // Re-reference from an average, as after a feed
+    restart(md, MEAL_ST_SETTLE);
+    return valid;
+}
+
+bool meal_detect_update(meal_detect_t *md, float grams, bool feeding,
+                        uint64_t now_ms, meal_session_t *out)
+{
+    if (md->state == MEAL_ST_INIT) {
+        md->filt = grams;
+        restart(md, feeding ? MEAL_ST_FEEDING : MEAL_ST_SETTLE);
+        return false;
+    }
+    md->filt += MEAL_EMA_ALPHA * (grams - md->filt);
+
+    if (feeding) {
+        // A feed cuts any session short; report what was eaten before it
+        bool done = (md->state == MEAL_ST_EATING) && finish(md, out);
+        md->state = MEAL_ST_FEEDING;
+        return done;
+    }
+
+    switch (md->state) {
+    case MEAL_ST_FEEDING:
+        restart(md, MEAL_ST_SETTLE);
+        return false;
+
+    case MEAL_ST_SETTLE:
+        // The reference is the mean of the raw samples at the end of the
+        // window; a single filtered sample is off by its noise
+        if (md->settle <= MEAL_SETTLE_AVG) md->acc += grams;
+        if (--md->settle == 0) {
+            md->ref = md->acc / (float)MEAL_SETTLE_AVG;
+            md->zero_ms = now_ms;
+            md->state = MEAL_ST_IDLE;
+        }
+        return false;
+
+    case MEAL_ST_IDLE:
+        if (md->filt < MEAL_LIFT_G) {
+            restart(md, MEAL_ST_SETTLE);
+            return false;
+        }
+        md->cusum += (md->ref - md->filt) - MEAL_CUSUM_K;
+        // The reference follows slow drift and step-ups. It follows on every
+        // sample: updated only while the CUSUM is zero it would track the
+        // high side of the noise and drift up into a false start.
+        md->ref += MEAL_REF_ALPHA * (md->filt - md->ref);
+        if (md->cusum <= 0.0f) {
+            md->cusum = 0.0f;
+            md->zero_ms = now_ms;
+        } else if (md->cusum > MEAL_CUSUM_H) {
+            md->state = MEAL_ST_EATING;
+            md->start_ms = md->zero_ms;
+            md->min = md->filt;
+            md->last_drop_ms = now_ms;
+        }
+        return false;
+
+    case MEAL_ST_EATING:
+        if (md->filt < MEAL_LIFT_G) {
+            // Bowl lifted mid-session: nothing trustworthy to report
+            restart(md, MEAL_ST_SETTLE);
+            return false;
+        }
+        // Stepwise minimum so a slow nibble still counts as progress
+        if (md->filt < md->min - MEAL_DROP_EPS) {
+            md->min = md->filt;
+            md->last_drop_ms = now_ms;
+        }
+        if (now_ms - md->last_drop_ms >= MEAL_END_QUIET_MS) {
+            return finish(md, out);
+        }
+        return false;
+
+    default:
+        return false;
+    }
+}
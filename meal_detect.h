@@ -0,0 +1,68 @@
+#ifndef USER_MEAL_DETECT_H
+#define USER_MEAL_DETECT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Streaming change-point detector for bowl weight (O(1) state per sensor).
+//
+// Each raw sample is smoothed with an EMA. While the feeder runs the
+// detector only watches; once the auger stops it waits for the reading to
+// settle and takes the mean of the last raw samples as the new reference,
+// so the feed step-up is never mistaken for anything else. A finished
+// session re-references the same way.
+//
+// With the feeder idle, a one-sided CUSUM on (reference - filtered) detects
+// a sustained decrease; the reference slowly follows the filtered value. The time the CUSUM last sat at zero is the session
+// start. The session ends once no new minimum has been seen for
+// MEAL_END_QUIET_MS; grams eaten is the reference minus that minimum.
+// There is no presence sensor, so a sustained decrease is taken as the pet
+// eating.
+
+#define MEAL_EMA_ALPHA        0.25f   // raw -> filtered
+#define MEAL_REF_ALPHA        0.015f  // filtered -> reference while idle
+#define MEAL_CUSUM_K          0.2f    // g per sample absorbed as noise/drift
+#define MEAL_CUSUM_H          8.0f    // g, decision threshold
+#define MEAL_DROP_EPS         0.5f    // g below the minimum that counts as eating
+#define MEAL_SETTLE_SAMPLES   40u     // samples after a feed before re-referencing
+#define MEAL_SETTLE_AVG       30u     // last samples of the settle window averaged into the reference
+#define MEAL_END_QUIET_MS     60000u
+#define MEAL_MIN_GRAMS        2.0f    // smaller sessions are dropped as noise
+#define MEAL_MAX_GRAMS        500.0f  // larger sessions are rejected
+#define MEAL_LIFT_G           -20.0f  // tare includes the bowl; below this it is off the scale
+
+typedef enum {
+    MEAL_ST_INIT = 0,   // no sample yet
+    MEAL_ST_SETTLE,     // waiting for the reading to settle
+    MEAL_ST_IDLE,       // tracking the reference, CUSUM armed
+    MEAL_ST_EATING,     // change point detected, tracking the minimum
+    MEAL_ST_FEEDING     // auger running
+} meal_state_t;
+
+typedef struct {
+    meal_state_t state;
+    float filt;          // EMA of the raw samples
+    float ref;           // in-control level before a session
+    float cusum;         // one-sided CUSUM of the decrease
+    float min;           // lowest filtered value in the current session
+    uint32_t settle;     // samples left in MEAL_ST_SETTLE
+    float acc;           // sum of the raw samples averaged in MEAL_ST_SETTLE
+    uint64_t zero_ms;    // last time the CUSUM was zero (change-point estimate)
+    uint64_t start_ms;
+    uint64_t last_drop_ms;
+} meal_detect_t;
+
+typedef struct {
+    uint64_t start_ms;   // tick_ms() times
+    uint64_t end_ms;
+    float grams;
+} meal_session_t;
+
+void meal_detect_init(meal_detect_t *md);
+
+// Feed one sample. 'feeding' is true while the auger is running. Returns
+// true and fills 'out' when an eating session has just ended.
+bool meal_detect_update(meal_detect_t *md, float grams, bool feeding,
+                        uint64_t now_ms, meal_session_t *out);
+
+#endif // USER_MEAL_DETECT_H
@@ -0,0 +1,80 @@
+#include "perf.h"
+
+#if PERF_ENABLE
+
+#include <string.h>
+
+#define CORE_DEMCR_R      (*(volatile uint32_t *)0xE000EDFCu)
+#define DEMCR_TRCENA      (1u << 24)
+#define DWT_CTRL_CYCCNTENA (1u << 0)
+
+static perf_stats_t g_perf[PERF_SITE_COUNT];
+
+static const char *const g_perf_names[PERF_SITE_COUNT] = {
+    [PERF_CMD_STATUS]   = "CMD_STATUS",
+    [PERF_CMD_STATUS2]  = "CMD_STATUS2",
+    [PERF_CMD_FEED]     = "CMD_FEED",
+    [PERF_CMD_LOG]      = "CMD_LOG",
+    [PERF_CMD_TARE]     = "CMD_TARE",
+    [PERF_CMD_CAL]      = "CMD_CAL",
+    [PERF_CMD_SETTIME]  = "CMD_SETTIME",
+    [PERF_CMD_SCHED]    = "CMD_SCHED",
+    [PERF_CMD_GETSCHED] = "CMD_GETSCHED",
+    [PERF_CMD_SCHEDEDIT] = "CMD_SCHEDEDIT",
+    [PERF_CMD_SNAPSHOT] = "CMD_SNAPSHOT",
+    [PERF_CMD_EEDIAG]   = "CMD_EEDIAG",
+    [PERF_CMD_TASKS]    = "CMD_TASKS",
+    [PERF_CMD_PERF]     = "CMD_PERF",
+    [PERF_CMD_OTHER]    = "CMD_OTHER",
+    [PERF_TICK_100MS]   = "TICK_100MS",
+    [PERF_TICK_1000MS]  = "TICK_1000MS",
+    [PERF_HX711_FOOD]   = "HX711_FOOD",
+    [PERF_HX711_WATER]  = "HX711_WATER",
+    [PERF_STEP]         = "STEP",
+};
+
+void perf_init(void)
+{
+    CORE_DEMCR_R |= DEMCR_TRCENA;
+    DWT_CYCCNT_R = 0;
+    DWT_CTRL_R |= DWT_CTRL_CYCCNTENA;
+    perf_reset();
+}
+
+static inline uint32_t hist_bucket(uint32_t cycles)
+{
+    if (cycles < 256u) return 0;
+    uint32_t log2 = 31u - (uint32_t)__builtin_clz(cycles);   // >= 8
+    uint32_t b = (log2 - 8u) / 2u + 1u;
+    return (b < PERF_HIST_BUCKETS) ? b : (PERF_HIST_BUCKETS - 1u);
+}
+
+void perf_record(perf_site_t site, uint32_t cycles)
+{
+    if ((unsigned)site >= PERF_SITE_COUNT) return;
+    perf_stats_t *p = &g_perf[site];
+    if (p->count == 0 || cycles < p->min) p->min = cycles;
+    if (cycles > p->max) p->max = cycles;
+    p->count++;
+    p->sum += cycles;
+    p->hist[hist_bucket(cycles)]++;
+}
+
+bool perf_get(perf_site_t site, perf_stats_t *out)
+{
+    if (!out || (unsigned)site >= PERF_SITE_COUNT) return false;
+    *out = g_perf[site];
+    return true;
+}
+
+const char *perf_site_name(perf_site_t site)
+{
+    return ((unsigned)site < PERF_SITE_COUNT) ? g_perf_names[site] : "?";
+}
+
+void perf_reset(void)
+{
+    memset(g_perf, 0, sizeof(g_perf));
+}
+
+#endif // PERF_ENABLE
@@ -0,0 +1,81 @@
+#ifndef USER_PERF_H
+#define USER_PERF_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Cycle-count profiling using the Cortex-M4 DWT cycle counter.
+// Build with -DPERF_ENABLE=0 to compile all instrumentation out; the
+// PERF_BEGIN/PERF_END macros then expand to nothing.
+#ifndef PERF_ENABLE
+#define PERF_ENABLE 1
+#endif
+
+// Histogram buckets: <256 cycles, then x4 per bucket, last is >= 1M cycles
+#define PERF_HIST_BUCKETS 8
+
+typedef enum {
+    // handle_at_command, per command
+    PERF_CMD_STATUS = 0,
+    PERF_CMD_STATUS2,
+    PERF_CMD_FEED,
+    PERF_CMD_LOG,
+    PERF_CMD_TARE,
+    PERF_CMD_CAL,
+    PERF_CMD_SETTIME,
+    PERF_CMD_SCHED,
+    PERF_CMD_GETSCHED,
+    PERF_CMD_SCHEDEDIT,
+    PERF_CMD_SNAPSHOT,
+    PERF_CMD_EEDIAG,
+    PERF_CMD_TASKS,
+    PERF_CMD_PERF,
+    PERF_CMD_OTHER,
+    // periodic work
+    PERF_TICK_100MS,
+    PERF_TICK_1000MS,
+    // drivers
+    PERF_HX711_FOOD,
+    PERF_HX711_WATER,
+    PERF_STEP,
+    PERF_SITE_COUNT
+} perf_site_t;
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t hist[PERF_HIST_BUCKETS];
+} perf_stats_t;
+
+#if PERF_ENABLE
+
+#define DWT_CTRL_R    (*(volatile uint32_t *)0xE0001000u)
+#define DWT_CYCCNT_R  (*(volatile uint32_t *)0xE0001004u)
+
+static inline uint32_t perf_cycles(void)
+{
+    return DWT_CYCCNT_R;
+}
+
+#define PERF_BEGIN(var)       uint32_t var = perf_cycles()
+#define PERF_END(site, var)   perf_record((site), perf_cycles() - (var))
+
+// Enable the DWT cycle counter; call once after the system clock is set
+void perf_init(void);
+void perf_record(perf_site_t site, uint32_t cycles);
+bool perf_get(perf_site_t site, perf_stats_t *out);
+const char *perf_site_name(perf_site_t site);
+void perf_reset(void);
+
+#else
+
+#define PERF_BEGIN(var)       ((void)0)
+#define PERF_END(site, var)   ((void)(site))
+
+static inline void perf_init(void) {}
+
+#endif // PERF_ENABLE
+
+#endif // USER_PERF_H
@@ -1,641 +1,1220 @@
-#include "proto.h"
-
-#include <string.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <stdarg.h>
-
-#include "inc/hw_memmap.h"
-#include "driverlib/gpio.h"
-#include "uart.h"
-#include "hx711_tiva.h"
-#include "stepper_uln2003.h"
-#include "eeprom_config.h"
-
-// Line buffer for incoming JSON (terminated by \n)
-#define RX_LINE_MAX 256
-static char rx_line[RX_LINE_MAX];
-static uint32_t rx_len = 0;
-
-// GLOBAL STATE
-static ProtoState S;
-
-// HX711 devices
-static hx711_t g_hx_food, g_hx_water;
-static const hx711_cfg_t g_hx_food_cfg = { GPIO_PORTE_BASE, 2, 3 };
-static const hx711_cfg_t g_hx_water_cfg = { GPIO_PORTE_BASE, 4, 5 };
-
-// Forward decls
-static void handle_at_command(const char *line);
-static void send_ok_data(const char *data);
-static void send_ok(void);
-static void ack_err(uint32_t seq, const char *err_code);
-static void cmd_at_status(void);
-static void cmd_at_feed(const char *param);
-static void cmd_at_log(void);
-static void cmd_at_tare(const char *param);
+#include "proto.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/sysctl.h"
+#include "uart.h"
+#include "tick.h"
+#include "task.h"
+#include "swtimer.h"
+#include "perf.h"
+#include "jitter.h"
+#include "meal_detect.h"
+#include "sched_parse.h"
+#include "hx711_tiva.h"
+#include "stepper_uln2003.h"
+#include "eeprom_config.h"
+
+// Line buffer for incoming JSON (terminated by \n)
+#define RX_LINE_MAX 256
+static char rx_line[RX_LINE_MAX];
+static uint32_t rx_len = 0;
+
+// AT+SCHED= parameters are parsed as they arrive instead of being buffered
+#define SCHED_PREFIX "AT+SCHED="
+#define SCHED_PREFIX_LEN (sizeof(SCHED_PREFIX) - 1u)
+static sched_parser_t g_sched_parser;
+static bool rx_sched_stream = false;
+
+// GLOBAL STATE
+static ProtoState S;
+
+// Unsolicited "+EVT: ..." lines. They are queued and only written between
+// commands, so an event never lands between a command and its +OK/+ERR.
+// Queuing one calls the event callback, which releases Proto_Poll() to
+// write it without waiting for the next command.
+// When the queue is full the oldest event is dropped and counted; the
+// next flush reports the loss as "+EVT: LOST,<n>".
+#define EVT_QUEUE_LEN 8
+#define EVT_LINE_MAX  40
+static char g_evt_queue[EVT_QUEUE_LEN][EVT_LINE_MAX];
+static uint8_t g_evt_head = 0;  // next slot to write
+static uint8_t g_evt_count = 0;
+static uint32_t g_evt_lost = 0;
+static void (*g_evt_callback)(void) = 0;
+
+// Software timers (see swtimer.h)
+static swtimer_t g_feed_step_timer;     // periodic, one half-step per expiry
+static swtimer_t g_feed_deadline_timer; // one-shot safety stop
+static swtimer_t g_time_request_timer;  // periodic AT+GETTIME retry
+static swtimer_t g_eeprom_retry_timer;  // EEPROM init backoff
+static swtimer_t g_baud_confirm_timer;  // AT+BAUD fallback if AT+BAUDOK never arrives
+static uint8_t g_eeprom_attempts = 0;
+static uint32_t g_boot_count = 0;       // from EEPROM, this boot included
+static bool g_eeprom_ok = false;
+
+// Eating-session detector on the food bowl
+static meal_detect_t g_meal_food;
+
+// Last good HX711 reading per sensor, for the sensor alarms
+static uint64_t g_food_ok_ms, g_water_ok_ms;
+
+// HX711 devices
+static hx711_t g_hx_food, g_hx_water;
+static const hx711_cfg_t g_hx_food_cfg = { GPIO_PORTE_BASE, 2, 3 };
+static const hx711_cfg_t g_hx_water_cfg = { GPIO_PORTE_BASE, 4, 5 };
+
+// Forward decls
+static void handle_at_command(const char *line);
+static void send_ok_data(const char *data);
+static void send_ok(void);
+static void ack_err(uint32_t seq, const char *err_code);
+static void cmd_at_status(const char *param);
+static void cmd_at_status2(const char *param);
+static void cmd_at_feed(const char *param);
+static void cmd_at_log(void);
+static void cmd_at_tare(const char *param);
 static void cmd_at_settime(const char *param);
 static void cmd_at_schedule(const char *param);
+static void sched_commit(sched_parser_t *p);
+static void send_sched_ver(void);
 static void cmd_at_get_schedule(void);
+static void cmd_at_snapshot(void);
+static void format_status(char *buf, size_t size);
+static void format_schedule(char *buf, size_t size);
+static void format_log(char *buf, size_t size);
+static void cmd_at_sched_add(const char *param);
+static void cmd_at_sched_del(const char *param);
+static void cmd_at_sched_set(const char *param);
 static void cmd_at_calibrate(const char *param);
 static void cmd_at_eeprom_diag(void);
-static bool eeprom_init_with_retry(void);
-
-extern uint32_t millis(void);
-static void format_HHMM(uint32_t unix_sec, char out[6]);
-static uint32_t now_unix(void);
-static int level_to_grams(const char *level);
-static inline uint32_t deg_to_steps(uint32_t deg);
-static bool is_amount_LMH(const char *s);
-
-// Time utility functions (formerly from rtc_ds3231.c)
-static bool is_leap_year(uint32_t year);
-static uint8_t calculate_weekday(uint32_t year, uint8_t month, uint8_t day);
-uint32_t rtc_time_to_unix(const rtc_time_t *t);
-bool rtc_unix_to_time(uint32_t unix_sec, rtc_time_t *t);
-
-// ============================================================================
-// Initialization & Main Loop
-// ============================================================================
-
+static void cmd_at_tasks(const char *param);
+static void cmd_at_perf(const char *param);
+static void cmd_at_jitter(const char *param);
+static void cmd_at_meals(void);
+static void cmd_at_uartstat(const char *param);
+static void cmd_at_baud(const char *param);
+static void cmd_at_baudok(void);
+static void cmd_at_echo(const char *param);
+static void baud_check_errors(void);
+static void baud_note_good_line(void);
+static void on_baud_confirm(swtimer_t *t, void *arg);
+static void meal_record(const meal_session_t *m);
+static void meal_restore_last(void);
+static void eeprom_try_init(void);
+static void evt_post(const char *fmt, ...);
+static void evt_flush(void);
+static void alarm_update(int bit, bool on);
+static void pump_set(bool on);
+
+static void format_HHMM(uint32_t unix_sec, char out[6]);
+static uint32_t now_unix(void);
+static int level_to_grams(const char *level);
+static inline uint32_t deg_to_steps(uint32_t deg);
+static bool is_amount_LMH(const char *s);
+static void schedule_check(void);
+static void feed_start(char level, uint32_t steps);
+static void feed_finish(void);
+static void on_feed_step(swtimer_t *t, void *arg);
+static void on_feed_deadline(swtimer_t *t, void *arg);
+static void on_time_request(swtimer_t *t, void *arg);
+static void on_eeprom_retry(swtimer_t *t, void *arg);
+
+// AT+GETTIME retry period while no time has been received
+#define TIME_REQUEST_RETRY_MS 60000u
+// EEPROM init attempts and backoff between them
+#define EEPROM_INIT_ATTEMPTS 3u
+#define EEPROM_RETRY_MS      10u
+// AT+BAUD: time allowed for AT+BAUDOK at the new rate, and the number of
+// framing/break errors (with no good command in between) that means the
+// peer is talking at another rate
+#define BAUD_CONFIRM_MS        1000u
+#define BAUD_FALLBACK_ERRORS   4u
+
+// Water level that turns the pump on and raises ALARM_WATER_LOW
+#define WATER_LOW_G 80
+// A sensor with no good reading for this long raises its alarm bit
+#define SENSOR_STALE_MS 2000u
+
+// Record a status-visible state change
+static inline void state_changed(void) { S.gen++; }
+
+// Weights only move once the reading differs by more than this, so HX711
+// noise of +-1 g does not defeat AT+STATUS?<gen>
+#define WEIGHT_DEADBAND_G 1
+
+static inline void state_set_int(int *field, int v) {
+    if (*field != v) {
+        *field = v;
+        state_changed();
+    }
+}
+
+static inline void state_set_weight(int *field, int v) {
+    int d = v - *field;
+    if (d > WEIGHT_DEADBAND_G || d < -WEIGHT_DEADBAND_G) state_set_int(field, v);
+}
+
+// Time utility functions (formerly from rtc_ds3231.c)
+static bool is_leap_year(uint32_t year);
+static uint8_t calculate_weekday(uint32_t year, uint8_t month, uint8_t day);
+uint32_t rtc_time_to_unix(const rtc_time_t *t);
+bool rtc_unix_to_time(uint32_t unix_sec, rtc_time_t *t);
+
+// ============================================================================
+// Initialization & Main Loop
+// ============================================================================
+
 void Proto_Init(void)
 {
     memset(&S, 0, sizeof(S));
     // Default placeholders
     strcpy(S.lastFed_time, "--:--");
-    strcpy(S.lastEaten_time, "--:--");
-    S.lastFed_amount = 0;
-    S.lastEaten_amount = 0;
-    S.unix_base = 0;
-    S.ms_at_sync = millis();
-    S.busy = false;
-    S.feed_step_delay_ms = FEED_STEP_DELAY_MS;
-    S.sched_len = 0;
-    S.sched_init = false;
-
-    // Request time from ESP32 on boot
-    UARTprintf("AT+GETTIME\r\n");
-    S.time_request_pending = true;
-    S.time_request_last_ms = millis();
-
-    hx711_init(&g_hx_food, &g_hx_food_cfg);
-    hx711_init(&g_hx_water, &g_hx_water_cfg);
-
+    strcpy(S.lastEaten_time, "--:--");
+    S.lastFed_amount = 0;
+    S.lastEaten_amount = 0;
+    S.unix_base = 0;
+    S.ms_at_sync = tick_ms();
+    S.busy = false;
+    S.feed_step_delay_ms = FEED_STEP_DELAY_MS;
+    S.sched_len = 0;
+    S.sched_init = false;
+
+    swtimer_init(&g_feed_step_timer, on_feed_step, NULL);
+    swtimer_init(&g_feed_deadline_timer, on_feed_deadline, NULL);
+    swtimer_init(&g_time_request_timer, on_time_request, NULL);
+    swtimer_init(&g_eeprom_retry_timer, on_eeprom_retry, NULL);
+    swtimer_init(&g_baud_confirm_timer, on_baud_confirm, NULL);
+    meal_detect_init(&g_meal_food);
+
+    // Request time from ESP32 on boot; retried until AT+SETTIME arrives
+    UARTprintf("AT+GETTIME\r\n");
+    S.time_request_pending = true;
+    swtimer_arm(&g_time_request_timer, TIME_REQUEST_RETRY_MS, TIME_REQUEST_RETRY_MS);
+
+    hx711_init(&g_hx_food, &g_hx_food_cfg);
+    hx711_init(&g_hx_water, &g_hx_water_cfg);
+
     // Configure PE1 as output for water pump
     GPIOPinTypeGPIOOutput(GPIO_PORTE_BASE, GPIO_PIN_1);
     GPIOPinWrite(GPIO_PORTE_BASE, GPIO_PIN_1, 0);  // Start with pump OFF
+    g_food_ok_ms = g_water_ok_ms = tick_ms();
 
-    if (eeprom_init_with_retry()) {
-        eeprom_load_calibration(&g_hx_food, &g_hx_water);
-        eeprom_load_schedule(&S);
-    }
+    g_eeprom_attempts = 0;
+    eeprom_try_init();
 }
-
+
 void Proto_Poll(void) {
-    char ch;
     static bool overflow_skip = false;
-    while (UART0_ReadChar(&ch)) {
-        if (ch == '\r') continue;
-        if (ch == '\n') {
-            if (overflow_skip) {
-                overflow_skip = false;
+    const char *span;
+    uint32_t n;
+    baud_check_errors();
+    // Drain the RX ring a contiguous span at a time
+    while ((n = UART0_RxSpan(&span)) > 0) {
+        for (uint32_t i = 0; i < n; i++) {
+            char ch = span[i];
+            if (ch == '\r') continue;
+            if (rx_sched_stream) {
+                if (ch != '\n') { sched_parse_feed(&g_sched_parser, ch); continue; }
+                rx_sched_stream = false;
                 rx_len = 0;
+                baud_note_good_line();
+                PERF_BEGIN(t_sched);
+                sched_commit(&g_sched_parser);
+                PERF_END(PERF_CMD_SCHED, t_sched);
+                continue;
+            }
+            if (ch == '\n') {
+                if (overflow_skip) {
+                    overflow_skip = false;
+                    rx_len = 0;
+                } else {
+                    rx_line[rx_len] = '\0';
+                    if (rx_len > 0) {
+                        // Optional guard to drop stray noise before "AT+"
+                        char *cmd_start = strstr(rx_line, "AT+");
+                        if (cmd_start) handle_at_command(cmd_start);
+                    }
+                    rx_len = 0;
+                }
             } else {
-                rx_line[rx_len] = '\0';
-                if (rx_len > 0) {
-                    // Optional guard to drop stray noise before "AT+"
-                    char *cmd_start = strstr(rx_line, "AT+");
-                    if (cmd_start) handle_at_command(cmd_start);
+                if (overflow_skip) continue;
+                if (rx_len < RX_LINE_MAX - 1) {
+                    rx_line[rx_len++] = ch;
+                    if (rx_len == SCHED_PREFIX_LEN &&
+                        memcmp(rx_line, SCHED_PREFIX, SCHED_PREFIX_LEN) == 0) {
+                        sched_parse_begin(&g_sched_parser);
+                        rx_sched_stream = true;
+                    }
+                } else {
+                    overflow_skip = true;
+                    rx_len = 0;
                 }
-                rx_len = 0;
             }
-        } else {
-            if (overflow_skip) continue;
-            if (rx_len < RX_LINE_MAX - 1) {
-                rx_line[rx_len++] = ch;
-            } else {
-                overflow_skip = true;
-                rx_len = 0;
-            }
-        }
-    }
-}
-
-void Proto_GetStatus(StatusSnapshot *out) {
-    if (!out) return;
-    out->bowl_g = S.bowl_g;
-    out->water_g = S.water_g;
-    out->alarm = S.alarm;
-}
-
-// ============================================================================
-// Ticks
-// ============================================================================
-
-void Proto_Tick10ms(void) {
-    if (S.feed_steps_remaining > MAX_FEED_STEPS) {
-        S.feed_steps_remaining = 0;
-        S.busy = false;
-        stepper_uln2003_all_off();
-    }
-    if (S.busy && S.feed_steps_remaining > 0) {
-        uint32_t nowms = millis();
-        // Check timeout/deadline
-        if ((int32_t)(nowms - S.feed_deadline_ms) >= 0) S.feed_steps_remaining = 0;
-        
-        // Time to step?
-        if (S.feed_steps_remaining > 0 && (int32_t)(nowms - S.feed_next_step_ms) >= 0) {
-            stepper_uln2003_step(+1);
-            S.feed_steps_remaining--;
-            S.feed_next_step_ms = nowms + S.feed_step_delay_ms;
-        }
-        
-        // Finished?
-        if (S.feed_steps_remaining == 0) {
-            S.busy = false;
-            if (S.unix_base > 0) {
-                uint32_t now = now_unix();
-                format_HHMM(now, S.lastFed_time);
-            }
-            S.lastFed_amount = S.feed_last_amount_g;
-            stepper_uln2003_all_off();
-        }
-    }
-    if (!S.busy && S.feed_steps_remaining == 0) stepper_uln2003_all_off();
-}
-
-void Proto_Tick100ms(void) {
-    if (hx711_data_ready(&g_hx_food)) {
-        float mass = 0.0f;
-        if (hx711_get_mass_timeout(&g_hx_food, &mass, 100)) S.bowl_g = (int)(mass + 0.5f);
-    }
-    if (hx711_data_ready(&g_hx_water)) {
-        float mass = 0.0f;
-        if (hx711_get_mass_timeout(&g_hx_water, &mass, 100)) {
-            S.water_g = (int)(mass + 0.5f);
-
-            // Water pump control: activate if below 80g
-            if (S.water_g < 80) {
-                GPIOPinWrite(GPIO_PORTE_BASE, GPIO_PIN_1, GPIO_PIN_1);  // Pump ON
-            } else {
-                GPIOPinWrite(GPIO_PORTE_BASE, GPIO_PIN_1, 0);  // Pump OFF
-            }
-        }
-    }
-}
-
-void Proto_Tick1000ms(void) {
-    // Retry time request every 60 seconds if pending
-    if (S.time_request_pending) {
-        if (millis() - S.time_request_last_ms >= 60000) {
-            UARTprintf("AT+GETTIME\r\n");
-            S.time_request_last_ms = millis();
-        }
-    }
-
-    if (S.unix_base == 0) return;
-
-    // Calculate current time (timezone already applied by ESP32)
-    uint32_t now = now_unix();
-    uint32_t sec_in_day = now % 86400;
-    uint16_t current_hh = (uint16_t)(sec_in_day / 3600u);
-    uint16_t current_mm = (uint16_t)((sec_in_day % 3600u) / 60u);
-    uint16_t current_minute = current_hh * 60u + current_mm;
-
-    if (!S.sched_init) {
-        S.last_sched_minute = current_minute;
-        S.sched_init = true;
-        return;
-    }
-    if (current_minute == S.last_sched_minute) return;
-    S.last_sched_minute = current_minute;
-
+        }
+        UART0_RxConsume(n);
+    }
+    // Only between lines: nothing of a command has arrived that is still
+    // waiting for its reply
+    if (rx_len == 0 && !rx_sched_stream && !overflow_skip) evt_flush();
+}
+
+void Proto_SetEventCallback(void (*cb)(void)) {
+    g_evt_callback = cb;
+}
+
+void Proto_GetStatus(StatusSnapshot *out) {
+    if (!out) return;
+    out->bowl_g = S.bowl_g;
+    out->water_g = S.water_g;
+    out->alarm = S.alarm;
+}
+
+// ============================================================================
+// Ticks
+// ============================================================================
+
+void Proto_Tick100ms(void) {
+    PERF_BEGIN(t_tick);
+    if (hx711_data_ready(&g_hx_food)) {
+        float mass = 0.0f;
+        PERF_BEGIN(t_hx);
+        bool ok = hx711_get_mass_timeout(&g_hx_food, &mass, 100);
+        PERF_END(PERF_HX711_FOOD, t_hx);
+        if (ok) {
+            g_food_ok_ms = tick_ms();
+            state_set_weight(&S.bowl_g, (int)(mass + 0.5f));
+            meal_session_t m;
+            if (meal_detect_update(&g_meal_food, mass, S.busy, tick_ms(), &m)) {
+                meal_record(&m);
+            }
+        }
+    }
+    if (hx711_data_ready(&g_hx_water)) {
+        float mass = 0.0f;
+        PERF_BEGIN(t_hx);
+        bool ok = hx711_get_mass_timeout(&g_hx_water, &mass, 100);
+        PERF_END(PERF_HX711_WATER, t_hx);
+        if (ok) {
+            g_water_ok_ms = tick_ms();
+            state_set_weight(&S.water_g, (int)(mass + 0.5f));
+
+            // Water pump control: activate if below WATER_LOW_G
+            pump_set(S.water_g < WATER_LOW_G);
+            alarm_update(ALARM_WATER_LOW, S.water_g < WATER_LOW_G);
+        }
+    }
+    uint64_t now = tick_ms();
+    alarm_update(ALARM_FOOD_SENSOR, now - g_food_ok_ms > SENSOR_STALE_MS);
+    alarm_update(ALARM_WATER_SENSOR, now - g_water_ok_ms > SENSOR_STALE_MS);
+    PERF_END(PERF_TICK_100MS, t_tick);
+}
+
+void Proto_Tick1000ms(void) {
+    PERF_BEGIN(t_tick);
+    schedule_check();
+    PERF_END(PERF_TICK_1000MS, t_tick);
+}
+
+// Start a feed when the wall-clock minute matches a schedule entry
+static void schedule_check(void) {
+    if (S.unix_base == 0) return;
+
+    // Calculate current time (timezone already applied by ESP32)
+    uint32_t now = now_unix();
+    uint32_t sec_in_day = now % 86400;
+    uint16_t current_hh = (uint16_t)(sec_in_day / 3600u);
+    uint16_t current_mm = (uint16_t)((sec_in_day % 3600u) / 60u);
+    uint16_t current_minute = current_hh * 60u + current_mm;
+
+    if (!S.sched_init) {
+        S.last_sched_minute = current_minute;
+        S.sched_init = true;
+        return;
+    }
+    if (current_minute == S.last_sched_minute) return;
+    S.last_sched_minute = current_minute;
+
     for (uint8_t i = 0; i < S.sched_len; i++) {
         uint16_t sched_minute = (uint16_t)S.sched[i].hh * 60u + (uint16_t)S.sched[i].mm;
         if (sched_minute == current_minute) {
+            evt_post("SCHED,%02u%02u%c,%s", S.sched[i].hh, S.sched[i].mm, S.sched[i].amount,
+                     S.busy ? "BUSY" : "RUN");
             if (!S.busy) {
-                char level = S.sched[i].amount;
-                uint32_t degrees = (level == 'L') ? FEED_DEG_L : (level == 'M') ? FEED_DEG_M : FEED_DEG_H;
-                uint32_t steps = deg_to_steps(degrees);
-                S.feed_steps_remaining = steps;
-                S.feed_step_delay_ms = FEED_STEP_DELAY_MS;
-                S.feed_next_step_ms = millis();
-                S.feed_deadline_ms = millis() + steps * S.feed_step_delay_ms + 1000u;
-                S.feed_last_amount_g = level_to_grams(&level);
-                S.busy = true;
-                break;
-            }
-        }
-    }
-}
-
-// ============================================================================
-// Command Handlers
-// ============================================================================
-
-static void handle_at_command(const char *line) {
-    if (strncmp(line, "AT+", 3) != 0) { ack_err(0, "SYNTAX"); return; }
-    const char *cmd = line + 3;
-    const char *eq = strchr(cmd, '=');
-    
-    if (strncmp(cmd, "STATUS", 6) == 0) cmd_at_status();
-    else if (strncmp(cmd, "FEED=", 5) == 0 && eq) cmd_at_feed(eq + 1);
-    else if (strncmp(cmd, "LOG", 3) == 0) cmd_at_log();
-    else if (strncmp(cmd, "TARE=", 5) == 0 && eq) cmd_at_tare(eq + 1);
-    else if (strncmp(cmd, "CAL=", 4) == 0 && eq) cmd_at_calibrate(eq + 1);
-    else if (strncmp(cmd, "SETTIME=", 8) == 0 && eq) cmd_at_settime(eq + 1);
-    else if (strncmp(cmd, "SCHED=", 6) == 0 && eq) cmd_at_schedule(eq + 1);
-    else if (strncmp(cmd, "GETSCHED", 8) == 0) cmd_at_get_schedule();
-    else if (strncmp(cmd, "EEDIAG", 6) == 0) cmd_at_eeprom_diag();
-    else ack_err(0, "UNKNOWN_CMD");
-}
-
-static void send_ok_data(const char *data) { UARTprintf("+OK: %s\r\n", data); }
-static void send_ok(void) { UARTprintf("+OK\r\n"); }
-static void ack_err(uint32_t seq, const char *err) { (void)seq; UARTprintf("+ERR: %s\r\n", err); }
-
-static void cmd_at_status(void) {
-    // Get current Unix timestamp
-    uint32_t now = now_unix();
-
-    // Convert to date/time components
-    rtc_time_t t;
-    rtc_unix_to_time(now, &t);
-
-    // Format time string: YYYY-MM-DD HH:MM:SS
-    char time_str[20];
-    snprintf(time_str, sizeof(time_str), "%04d-%02d-%02d %02d:%02d:%02d",
-             t.year, t.month, t.date, t.hour, t.min, t.sec);
-
-    // Build status response with time first
-    char buf[128];
-    snprintf(buf, sizeof(buf), "TIME=%s,BOWL=%d,WATER=%d,ALARM=%d,BUSY=%d",
-             time_str, S.bowl_g, S.water_g, S.alarm, S.busy);
-    send_ok_data(buf);
-}
-
-static void cmd_at_feed(const char *param) {
-    if (S.busy) { ack_err(0, "BUSY"); return; }
-    char level = param[0];
-    if (!is_amount_LMH(param)) { ack_err(0, "PARAM_ERR"); return; }
-    
-    uint32_t degrees = (level=='L')?FEED_DEG_L:(level=='M')?FEED_DEG_M:FEED_DEG_H;
-    S.feed_steps_remaining = deg_to_steps(degrees);
-    S.feed_step_delay_ms = FEED_STEP_DELAY_MS;
-    S.feed_next_step_ms = millis();
-    S.feed_deadline_ms = millis() + S.feed_steps_remaining * 10 + 1000;
-    S.feed_last_amount_g = level_to_grams(&level);
-    S.busy = true;
-    send_ok();
-}
-
-static void cmd_at_log(void) {
-    char buf[128];
-    snprintf(buf, sizeof(buf), "FED_TIME=%s,FED_AMT=%d,EAT_TIME=%s,EAT_AMT=%d", 
-        S.lastFed_time, S.lastFed_amount, S.lastEaten_time, S.lastEaten_amount);
-    send_ok_data(buf);
-}
-
-static void cmd_at_tare(const char *param) {
-    hx711_t *dev = (strncmp(param,"FOOD",4)==0) ? &g_hx_food : (strncmp(param,"WATER",5)==0) ? &g_hx_water : NULL;
-    if (!dev) { ack_err(0, "PARAM_ERR"); return; }
-    int32_t raw;
-    if (!hx711_read_raw_timeout(dev, &raw, 500)) { ack_err(0, "TIMEOUT"); return; }
-    hx711_set_offset(dev, raw);
-    eeprom_save_calibration(&g_hx_food, &g_hx_water);
-    send_ok();
-}
-
-static void cmd_at_calibrate(const char *param) {
-    // Expected: SENSOR,WEIGHT
-    char sensor[10]; const char *comma = strchr(param, ',');
-    if (!comma) { ack_err(0, "PARAM_ERR"); return; }
-    int len = comma - param;
-    if (len >= 10) len=9;
-    memcpy(sensor, param, len); sensor[len]=0;
-    int weight = atoi(comma+1);
-    if (weight <= 0) { ack_err(0, "PARAM_ERR"); return; }
-    
-    hx711_t *dev = (strcmp(sensor,"FOOD")==0) ? &g_hx_food : (strcmp(sensor,"WATER")==0) ? &g_hx_water : NULL;
-    if (!dev) { ack_err(0, "PARAM_ERR"); return; }
-    int32_t raw;
-    if (!hx711_read_raw_timeout(dev, &raw, 500)) { ack_err(0, "TIMEOUT"); return; }
-    float new_scale = (float)(raw - dev->offset) / (float)weight;
-    if (new_scale <= 0) { ack_err(0, "CAL_ERR"); return; }
-    hx711_set_scale(dev, new_scale);
-    eeprom_save_calibration(&g_hx_food, &g_hx_water);
-    send_ok();
-}
-
+                char level = S.sched[i].amount;
+                uint32_t degrees = (level == 'L') ? FEED_DEG_L : (level == 'M') ? FEED_DEG_M : FEED_DEG_H;
+                feed_start(level, deg_to_steps(degrees));
+                break;
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Command Handlers
+// ============================================================================
+
+static void handle_at_command(const char *line) {
+    if (strncmp(line, "AT+", 3) != 0) { ack_err(0, "SYNTAX"); return; }
+    const char *cmd = line + 3;
+    const char *eq = strchr(cmd, '=');
+    
+    perf_site_t site = PERF_CMD_OTHER;
+    PERF_BEGIN(t0);
+    baud_note_good_line();
+    if (strncmp(cmd, "STATUS2", 7) == 0) { site = PERF_CMD_STATUS2; cmd_at_status2(cmd[7] == '?' ? cmd + 8 : NULL); }
+    else if (strncmp(cmd, "STATUS", 6) == 0) { site = PERF_CMD_STATUS; cmd_at_status(cmd[6] == '?' ? cmd + 7 : NULL); }
+    else if (strncmp(cmd, "FEED=", 5) == 0 && eq) { site = PERF_CMD_FEED; cmd_at_feed(eq + 1); }
+    else if (strncmp(cmd, "MEALS", 5) == 0) cmd_at_meals();
+    else if (strncmp(cmd, "SNAPSHOT", 8) == 0) { site = PERF_CMD_SNAPSHOT; cmd_at_snapshot(); }
+    else if (strncmp(cmd, "LOG", 3) == 0) { site = PERF_CMD_LOG; cmd_at_log(); }
+    else if (strncmp(cmd, "TARE=", 5) == 0 && eq) { site = PERF_CMD_TARE; cmd_at_tare(eq + 1); }
+    else if (strncmp(cmd, "CAL=", 4) == 0 && eq) { site = PERF_CMD_CAL; cmd_at_calibrate(eq + 1); }
+    else if (strncmp(cmd, "SETTIME=", 8) == 0 && eq) { site = PERF_CMD_SETTIME; cmd_at_settime(eq + 1); }
+    else if (strncmp(cmd, "SCHED=", 6) == 0 && eq) { site = PERF_CMD_SCHED; cmd_at_schedule(eq + 1); }
+    else if (strncmp(cmd, "GETSCHED", 8) == 0) { site = PERF_CMD_GETSCHED; cmd_at_get_schedule(); }
+    else if (strncmp(cmd, "SCHEDADD=", 9) == 0 && eq) { site = PERF_CMD_SCHEDEDIT; cmd_at_sched_add(eq + 1); }
+    else if (strncmp(cmd, "SCHEDDEL=", 9) == 0 && eq) { site = PERF_CMD_SCHEDEDIT; cmd_at_sched_del(eq + 1); }
+    else if (strncmp(cmd, "SCHEDSET=", 9) == 0 && eq) { site = PERF_CMD_SCHEDEDIT; cmd_at_sched_set(eq + 1); }
+    else if (strncmp(cmd, "EEDIAG", 6) == 0) { site = PERF_CMD_EEDIAG; cmd_at_eeprom_diag(); }
+    else if (strncmp(cmd, "TASKS", 5) == 0) { site = PERF_CMD_TASKS; cmd_at_tasks(eq ? eq + 1 : NULL); }
+    else if (strncmp(cmd, "PERF", 4) == 0) { site = PERF_CMD_PERF; cmd_at_perf(eq ? eq + 1 : NULL); }
+    else if (strncmp(cmd, "JITTER", 6) == 0) cmd_at_jitter(eq ? eq + 1 : NULL);
+    else if (strncmp(cmd, "UARTSTAT", 8) == 0) cmd_at_uartstat(eq ? eq + 1 : NULL);
+    else if (strncmp(cmd, "BAUDOK", 6) == 0) cmd_at_baudok();
+    else if (strncmp(cmd, "BAUD=", 5) == 0 && eq) cmd_at_baud(eq + 1);
+    else if (strncmp(cmd, "ECHO=", 5) == 0 && eq) cmd_at_echo(eq + 1);
+    else ack_err(0, "UNKNOWN_CMD");
+    PERF_END(site, t0);
+}
+
+static void send_ok_data(const char *data) { UARTprintf("+OK: %s\r\n", data); }
+static void send_ok(void) { UARTprintf("+OK\r\n"); }
+static void ack_err(uint32_t seq, const char *err) { (void)seq; UARTprintf("+ERR: %s\r\n", err); }
+
+// AT+STATUS?<gen> -> "+OK: SAME" if nothing visible changed since <gen>
+// "?<gen>" suffix of AT+STATUS / AT+STATUS2 matching the current generation
+static bool status_gen_current(const char *param) {
+    if (!param || !*param) return false;
+    char *end;
+    unsigned long gen = strtoul(param, &end, 10);
+    return end != param && *end == '\0' && gen == S.gen;
+}
+
+static char *put_u32(char *p, uint32_t v) {
+    char tmp[10];
+    int n = 0;
+    do { tmp[n++] = (char)('0' + v % 10u); v /= 10u; } while (v);
+    while (n) *p++ = tmp[--n];
+    return p;
+}
+
+static char *put_i32(char *p, int32_t v) {
+    if (v < 0) { *p++ = '-'; return put_u32(p, 0u - (uint32_t)v); }
+    return put_u32(p, (uint32_t)v);
+}
+
+// AT+STATUS2[?<gen>] -> "+OK: 2,<gen>,<epoch>,<ms>,<bowl>,<water>,<alarm>,
+//                         <busy>,<feed_pct>,<health>"
+// Fixed field order, integers only: epoch is local Unix seconds (0 before
+// AT+SETTIME) and ms the milliseconds into that second. New fields are
+// only ever appended. Feed progress does not bump the generation, so a
+// running feed always gets the full reply.
+static void cmd_at_status2(const char *param) {
+    if (!S.busy && status_gen_current(param)) { send_ok_data("SAME"); return; }
+
+    uint64_t elapsed = tick_ms() - S.ms_at_sync;
+    uint32_t epoch = S.unix_base ? S.unix_base + (uint32_t)(elapsed / 1000u) : 0u;
+    uint32_t ms = S.unix_base ? (uint32_t)(elapsed % 1000u) : 0u;
+    uint32_t pct = 0;
+    if (S.busy && S.feed_steps_total) {
+        pct = (S.feed_steps_total - S.feed_steps_remaining) * 100u / S.feed_steps_total;
+    }
+    uint32_t health = 0;
+    if (!(S.alarm & ALARM_FOOD_SENSOR)) health |= HEALTH_FOOD_SENSOR;
+    if (!(S.alarm & ALARM_WATER_SENSOR)) health |= HEALTH_WATER_SENSOR;
+    if (S.unix_base) health |= HEALTH_TIME_SYNCED;
+    if (g_eeprom_ok) health |= HEALTH_EEPROM;
+
+    char buf[96];
+    char *p = buf;
+    *p++ = '2';
+    *p++ = ','; p = put_u32(p, S.gen);
+    *p++ = ','; p = put_u32(p, epoch);
+    *p++ = ','; p = put_u32(p, ms);
+    *p++ = ','; p = put_i32(p, S.bowl_g);
+    *p++ = ','; p = put_i32(p, S.water_g);
+    *p++ = ','; p = put_u32(p, (uint32_t)S.alarm);
+    *p++ = ','; *p++ = S.busy ? '1' : '0';
+    *p++ = ','; p = put_u32(p, pct);
+    *p++ = ','; p = put_u32(p, health);
+    *p = '\0';
+    send_ok_data(buf);
+}
+
+static void cmd_at_status(const char *param) {
+    if (status_gen_current(param)) {
+        send_ok_data("SAME");
+        return;
+    }
+
+    char buf[128];
+    format_status(buf, sizeof(buf));
+    send_ok_data(buf);
+}
+
+// "TIME=YYYY-MM-DD HH:MM:SS,BOWL=<g>,WATER=<g>,ALARM=<b>,BUSY=<b>,GEN=<n>"
+static void format_status(char *buf, size_t size) {
+    // Get current Unix timestamp
+    uint32_t now = now_unix();
+
+    // Convert to date/time components
+    rtc_time_t t;
+    rtc_unix_to_time(now, &t);
+
+    // Format time string: YYYY-MM-DD HH:MM:SS
+    char time_str[20];
+    snprintf(time_str, sizeof(time_str), "%04d-%02d-%02d %02d:%02d:%02d",
+             t.year, t.month, t.date, t.hour, t.min, t.sec);
+
+    // Build status response with time first
+    snprintf(buf, size, "TIME=%s,BOWL=%d,WATER=%d,ALARM=%d,BUSY=%d,GEN=%lu",
+             time_str, S.bowl_g, S.water_g, S.alarm, S.busy, (unsigned long)S.gen);
+}
+
+static void cmd_at_feed(const char *param) {
+    if (S.busy) { ack_err(0, "BUSY"); return; }
+    char level = param[0];
+    if (!is_amount_LMH(param)) { ack_err(0, "PARAM_ERR"); return; }
+    
+    uint32_t degrees = (level=='L')?FEED_DEG_L:(level=='M')?FEED_DEG_M:FEED_DEG_H;
+    feed_start(level, deg_to_steps(degrees));
+    send_ok();
+}
+
+static void cmd_at_log(void) {
+    char buf[128];
+    format_log(buf, sizeof(buf));
+    send_ok_data(buf);
+}
+
+static void format_log(char *buf, size_t size) {
+    snprintf(buf, size, "FED_TIME=%s,FED_AMT=%d,EAT_TIME=%s,EAT_AMT=%d,EAT_DUR=%lu", 
+        S.lastFed_time, S.lastFed_amount, S.lastEaten_time, S.lastEaten_amount,
+        (unsigned long)S.lastEaten_duration_s);
+}
+
+// AT+MEALS -> "+OK: start_unix,duration_s,grams;..." newest first
+static void cmd_at_meals(void) {
+    char buf[EEPROM_HISTORY_RECORDS * 24 + 1];
+    size_t off = 0;
+    buf[0] = '\0';
+    eeprom_meal_t rec;
+    for (uint32_t i = 0; eeprom_history_get(i, &rec); i++) {
+        off += (size_t)snprintf(buf + off, sizeof(buf) - off, "%lu,%u,%u;",
+                                (unsigned long)rec.start_unix, rec.duration_s, rec.grams);
+        if (off >= sizeof(buf)) break;
+    }
+    send_ok_data(buf);
+}
+
+static void cmd_at_tare(const char *param) {
+    hx711_t *dev = (strncmp(param,"FOOD",4)==0) ? &g_hx_food : (strncmp(param,"WATER",5)==0) ? &g_hx_water : NULL;
+    if (!dev) { ack_err(0, "PARAM_ERR"); return; }
+    int32_t raw;
+    if (!hx711_read_raw_timeout(dev, &raw, 500)) { ack_err(0, "TIMEOUT"); return; }
+    hx711_set_offset(dev, raw);
+    eeprom_save_calibration(&g_hx_food, &g_hx_water);
+    send_ok();
+}
+
+static void cmd_at_calibrate(const char *param) {
+    // Expected: SENSOR,WEIGHT
+    char sensor[10]; const char *comma = strchr(param, ',');
+    if (!comma) { ack_err(0, "PARAM_ERR"); return; }
+    int len = comma - param;
+    if (len >= 10) len=9;
+    memcpy(sensor, param, len); sensor[len]=0;
+    int weight = atoi(comma+1);
+    if (weight <= 0) { ack_err(0, "PARAM_ERR"); return; }
+    
+    hx711_t *dev = (strcmp(sensor,"FOOD")==0) ? &g_hx_food : (strcmp(sensor,"WATER")==0) ? &g_hx_water : NULL;
+    if (!dev) { ack_err(0, "PARAM_ERR"); return; }
+    int32_t raw;
+    if (!hx711_read_raw_timeout(dev, &raw, 500)) { ack_err(0, "TIMEOUT"); return; }
+    float new_scale = (float)(raw - dev->offset) / (float)weight;
+    if (new_scale <= 0) { ack_err(0, "CAL_ERR"); return; }
+    hx711_set_scale(dev, new_scale);
+    eeprom_save_calibration(&g_hx_food, &g_hx_water);
+    send_ok();
+}
+
 static void cmd_at_settime(const char *param) {
-    // Parse: AT+SETTIME=1733472000 (timezone already applied by ESP32)
-    uint32_t timestamp = strtoul(param, NULL, 10);
-
-    if (timestamp == 0) {
-        ack_err(0, "INVALID_TIMESTAMP");
-        return;
-    }
-
-    // Update time base
-    S.unix_base = timestamp;
-    S.ms_at_sync = millis();
-    S.time_request_pending = false;  // Cancel any pending requests
-
-    send_ok();
-}
-
+    // Parse: AT+SETTIME=1733472000 (timezone already applied by ESP32)
+    uint32_t timestamp = strtoul(param, NULL, 10);
+
+    if (timestamp == 0) {
+        ack_err(0, "INVALID_TIMESTAMP");
+        return;
+    }
+
+    // Update time base
+    S.unix_base = timestamp;
+    state_changed();
+    S.ms_at_sync = tick_ms();
+    S.time_request_pending = false;  // Cancel any pending requests
+    swtimer_cancel(&g_time_request_timer);
+
+    send_ok();
+}
+
+// AT+SCHED= that did not start the line (e.g. noise before "AT+") is
+// buffered as usual and run through the same parser here
 static void cmd_at_schedule(const char *param) {
-    if (!param || strlen(param) == 0) {
+    sched_parse_begin(&g_sched_parser);
+    for (; param && *param; param++) sched_parse_feed(&g_sched_parser, *param);
+    sched_commit(&g_sched_parser);
+}
+
+// End of an AT+SCHED= line: swap the parsed list in and persist it
+static void sched_commit(sched_parser_t *p) {
+    sched_parse_result_t r = sched_parse_end(p);
+    if (r == SCHED_PARSE_EMPTY) {
         ack_err(0, "PARAM_ERR");
         return;
     }
-    if (strcmp(param, "NONE") == 0) {
+    // Re-sending the current schedule (ESP32 retries, the link benchmark)
+    // keeps its version and does not wear the EEPROM
+    uint8_t len = (r == SCHED_PARSE_NONE) ? 0u : p->len;
+    bool same = (len == S.sched_len);
+    for (int i = 0; same && i < len; i++) {
+        same = S.sched[i].hh == p->entries[i].hh && S.sched[i].mm == p->entries[i].mm &&
+               S.sched[i].amount == p->entries[i].amount;
+    }
+    if (same) {
+        send_sched_ver();
+        return;
+    }
+    if (r == SCHED_PARSE_NONE) {
         S.sched_len = 0;
         memset(S.sched, 0, sizeof(S.sched));
-        eeprom_save_schedule(&S);
-        send_ok();
-        return;
+    } else {
+        S.sched_len = p->len;
+        for (int i = 0; i < p->len; i++) {
+            S.sched[i].hh = p->entries[i].hh;
+            S.sched[i].mm = p->entries[i].mm;
+            S.sched[i].amount = p->entries[i].amount;
+            S.sched[i].en = 1; // Enable flag removed from protocol; always on
+        }
     }
+    S.sched_ver++;
+    eeprom_save_schedule(&S);
+    send_sched_ver();
+}
 
-    // 1. Copy to local buffer because strtok modifies the string
-    char buf[256];
-    strncpy(buf, param, sizeof(buf)-1);
-    buf[sizeof(buf)-1] = '\0';
-
-    // 2. Parse into temporary array
-    struct { uint8_t hh, mm; char amount; uint8_t en; } temp_sched[8];
-    uint8_t temp_len = 0;
-
-    // Use strtok to split by semicolon ';'
-    char *token = strtok(buf, ";");
-    uint8_t iteration_count = 0;
-    while (token != NULL && iteration_count < 16) {  // Add safety limit
-        iteration_count++;
-        if (temp_len >= 8) break; // Max 8 entries
-
-        // Expected new format: "HHMMA" (e.g., "0700M"); fall back to legacy "HH:MM,A,E"
-        bool parsed = false;
-        uint8_t hh = 0, mm = 0;
-        char amt = 0;
-
-        size_t len = strlen(token);
-        if (len >= 5) {
-            amt = token[len - 1];
-            if (amt == 'L' || amt == 'M' || amt == 'H') {
-                // Collect exactly 4 digits from the time portion (ignore ':' or other separators)
-                char digits[5] = {0};
-                uint8_t dcount = 0;
-                for (size_t k = 0; k < len - 1 && dcount < 4; k++) {
-                    if (token[k] >= '0' && token[k] <= '9') {
-                        digits[dcount++] = token[k];
-                    }
-                }
-                if (dcount == 4) {
-                    hh = (uint8_t)((digits[0] - '0') * 10 + (digits[1] - '0'));
-                    mm = (uint8_t)((digits[2] - '0') * 10 + (digits[3] - '0'));
-                    parsed = true;
-                }
-            }
-        }
+// Reply "+OK: V=<ver>" after a schedule change
+static void send_sched_ver(void) {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "V=%lu", (unsigned long)S.sched_ver);
+    send_ok_data(buf);
+}
 
-        // Legacy format support: "HH:MM,A,E"
-        if (!parsed) {
-            char *colon = strchr(token, ':');
-            char *comma1 = colon ? strchr(colon, ',') : NULL;
-            if (comma1) {
-                hh = (uint8_t)atoi(token);
-                mm = (uint8_t)atoi(colon + 1);
-                amt = *(comma1 + 1);
-                parsed = (amt == 'L' || amt == 'M' || amt == 'H');
-            }
-        }
+// Leading "<ver>," of an edit command. Replies +ERR: VER when the sender's
+// view of the schedule is stale, so it can re-read it or send a full list.
+static const char *sched_check_ver(const char *param) {
+    char *end;
+    unsigned long ver = strtoul(param, &end, 10);
+    if (end == param || *end != ',') { ack_err(0, "PARAM_ERR"); return NULL; }
+    if (ver != S.sched_ver) { ack_err(0, "VER"); return NULL; }
+    return end + 1;
+}
 
-        bool time_ok = parsed && (hh <= 23) && (mm <= 59);
+// One "HHMMA" (or legacy) entry, through the same parser as AT+SCHED
+static bool sched_parse_one(const char *s, sched_entry_t *out) {
+    sched_parser_t p;
+    sched_parse_begin(&p);
+    for (; *s; s++) sched_parse_feed(&p, *s);
+    if (sched_parse_end(&p) != SCHED_PARSE_LIST || p.tokens != 1 || p.len != 1) return false;
+    *out = p.entries[0];
+    return true;
+}
 
-        if (time_ok) {
-            temp_sched[temp_len].hh = (uint8_t)hh;
-            temp_sched[temp_len].mm = (uint8_t)mm;
-            temp_sched[temp_len].amount = amt;
-            temp_sched[temp_len].en = 1; // Enable flag removed from protocol; always on
-            temp_len++;
-        }
-        token = strtok(NULL, ";");
-    }
-
-    // 3. Update Global State
-    // FIXED: Use member-wise assignment to avoid compiler error #513 with anonymous structs
-    S.sched_len = temp_len;
-    for (int i = 0; i < temp_len; i++) {
-        S.sched[i].hh = temp_sched[i].hh;
-        S.sched[i].mm = temp_sched[i].mm;
-        S.sched[i].amount = temp_sched[i].amount;
-        S.sched[i].en = temp_sched[i].en;
-    }
-
-    // 4. Save to EEPROM for persistence
-    eeprom_save_schedule(&S);
-
-    send_ok();
-}
+static void sched_put(int idx, const sched_entry_t *e) {
+    S.sched[idx].hh = e->hh;
+    S.sched[idx].mm = e->mm;
+    S.sched[idx].amount = e->amount;
+    S.sched[idx].en = 1;
+}
+
+// AT+SCHEDADD=<ver>,<HHMMA> -> append
+static void cmd_at_sched_add(const char *param) {
+    const char *rest = sched_check_ver(param);
+    if (!rest) return;
+    sched_entry_t e;
+    if (!sched_parse_one(rest, &e)) { ack_err(0, "PARAM_ERR"); return; }
+    if (S.sched_len >= 8) { ack_err(0, "FULL"); return; }
+    sched_put(S.sched_len, &e);
+    S.sched_len++;
+    S.sched_ver++;
+    eeprom_save_schedule_entries(&S, S.sched_len - 1u, 1u);
+    send_sched_ver();
+}
+
+// AT+SCHEDDEL=<ver>,<idx> -> remove, later entries move down one
+static void cmd_at_sched_del(const char *param) {
+    const char *rest = sched_check_ver(param);
+    if (!rest) return;
+    char *end;
+    unsigned long idx = strtoul(rest, &end, 10);
+    if (end == rest || *end != '\0' || idx >= S.sched_len) { ack_err(0, "PARAM_ERR"); return; }
+    for (uint32_t i = idx; i + 1u < S.sched_len; i++) S.sched[i] = S.sched[i + 1u];
+    S.sched_len--;
+    memset(&S.sched[S.sched_len], 0, sizeof(S.sched[0]));
+    S.sched_ver++;
+    eeprom_save_schedule_entries(&S, idx, S.sched_len - idx);
+    send_sched_ver();
+}
+
+// AT+SCHEDSET=<ver>,<idx>,<HHMMA> -> replace in place
+static void cmd_at_sched_set(const char *param) {
+    const char *rest = sched_check_ver(param);
+    if (!rest) return;
+    char *end;
+    unsigned long idx = strtoul(rest, &end, 10);
+    if (end == rest || *end != ',' || idx >= S.sched_len) { ack_err(0, "PARAM_ERR"); return; }
+    sched_entry_t e;
+    if (!sched_parse_one(end + 1, &e)) { ack_err(0, "PARAM_ERR"); return; }
+    sched_put((int)idx, &e);
+    S.sched_ver++;
+    eeprom_save_schedule_entries(&S, idx, 1u);
+    send_sched_ver();
+}
 
 static void cmd_at_get_schedule(void) {
     char buf[256]; 
-    size_t off=0;
-    buf[0] = '\0';
+    format_schedule(buf, sizeof(buf));
+    send_ok_data(buf);
+}
+
+// "V=<ver>;0700M;1200L" or "V=<ver>;NONE"
+static void format_schedule(char *buf, size_t size) {
+    size_t off = (size_t)snprintf(buf, size, "V=%lu", (unsigned long)S.sched_ver);
 
     if (S.sched_len == 0) {
-        send_ok_data("NONE");
+        snprintf(buf + off, size - off, ";NONE");
         return;
     }
     
     for(int i=0; i<S.sched_len; i++) {
-        if(i > 0) {
-            if (off < sizeof(buf) - 1) buf[off++] = ';';
-        }
-        int remaining = sizeof(buf) - off;
+        if (off < size - 1) buf[off++] = ';';
+        int remaining = (int)(size - off);
         if (remaining > 0) {
             off += snprintf(buf+off, remaining, "%02d%02d%c", 
                             S.sched[i].hh, S.sched[i].mm, S.sched[i].amount);
         }
-    }
-    // Ensure null termination just in case
-    if (off < sizeof(buf)) buf[off] = 0;
-    else buf[sizeof(buf)-1] = 0;
-    
-    send_ok_data(buf);
-}
-
+    }
+    // Ensure null termination just in case
+    if (off < size) buf[off] = 0;
+    else buf[size-1] = 0;
+}
+
+// AT+SNAPSHOT -> everything the ESP32 caches, in one exchange:
+//   +SNAP: FW,VER=<fw>,BOOT=<n>,BAUD=<rate>
+//   +SNAP: STATUS,<as AT+STATUS>
+//   +SNAP: SCHED,<as AT+GETSCHED>
+//   +SNAP: LOG,<as AT+LOG>
+//   +SNAP: CAL,FOOD_SCALE_X1000=<n>,FOOD_OFF=<n>,WATER_SCALE_X1000=<n>,WATER_OFF=<n>
+//   +OK: SNAP
+static void cmd_at_snapshot(void) {
+    char buf[256];
+    UARTprintf("+SNAP: FW,VER=%s,BOOT=%lu,BAUD=%lu\r\n", FW_VERSION,
+               (unsigned long)g_boot_count, (unsigned long)UART0_GetBaud());
+    format_status(buf, sizeof(buf));
+    UARTprintf("+SNAP: STATUS,%s\r\n", buf);
+    format_schedule(buf, sizeof(buf));
+    UARTprintf("+SNAP: SCHED,%s\r\n", buf);
+    format_log(buf, sizeof(buf));
+    UARTprintf("+SNAP: LOG,%s\r\n", buf);
+    UARTprintf("+SNAP: CAL,FOOD_SCALE_X1000=%ld,FOOD_OFF=%ld,WATER_SCALE_X1000=%ld,WATER_OFF=%ld\r\n",
+               (long)(g_hx_food.scale * 1000.0f), (long)g_hx_food.offset,
+               (long)(g_hx_water.scale * 1000.0f), (long)g_hx_water.offset);
+    send_ok_data("SNAP");
+}
+
 static void cmd_at_eeprom_diag(void) {
     bool ok = eeprom_check_integrity();
     send_ok_data(ok ? "PASS" : "FAIL");
 }
 
-// Some boards occasionally fail EEPROM init on first boot; retry a few times.
-static bool eeprom_init_with_retry(void) {
-    for (int i = 0; i < 3; i++) {
-        if (eeprom_config_init()) return true;
-        uint32_t target = millis() + 10u; // short backoff
-        while ((int32_t)(millis() - target) < 0) { /* spin */ }
+// AT+TASKS -> NAME=runs/mean_us/max_us/overruns/missed;...
+// AT+TASKS=RESET clears the counters
+static void cmd_at_tasks(const char *param) {
+    if (param) {
+        if (strcmp(param, "RESET") != 0) { ack_err(0, "PARAM_ERR"); return; }
+        task_reset_stats();
+        send_ok();
+        return;
+    }
+    char buf[256];
+    size_t off = 0;
+    buf[0] = '\0';
+    for (int id = 0; id < TASK_MAX; id++) {
+        task_stats_t st;
+        if (!task_get_stats(id, &st)) continue;
+        uint32_t mean = st.runs ? (uint32_t)(st.total_us / st.runs) : 0u;
+        int n = snprintf(buf + off, sizeof(buf) - off, "%s%s=%lu/%lu/%lu/%lu/%lu",
+                         off ? ";" : "", st.name, (unsigned long)st.runs, (unsigned long)mean,
+                         (unsigned long)st.max_us, (unsigned long)st.overruns,
+                         (unsigned long)st.missed);
+        if (n < 0 || (size_t)n >= sizeof(buf) - off) break;
+        off += (size_t)n;
+    }
+    send_ok_data(buf);
+}
+
+// AT+PERF -> one "+PERF: SITE,count,min,max,mean,h0/../h7" line per site
+// that has samples (cycles at CLK Hz), then "+OK: CLK=<hz>"
+// AT+PERF=RESET clears all sites
+static void cmd_at_perf(const char *param) {
+#if PERF_ENABLE
+    if (param) {
+        if (strcmp(param, "RESET") != 0) { ack_err(0, "PARAM_ERR"); return; }
+        perf_reset();
+        send_ok();
+        return;
+    }
+    for (int site = 0; site < PERF_SITE_COUNT; site++) {
+        perf_stats_t p;
+        if (!perf_get((perf_site_t)site, &p) || p.count == 0) continue;
+        UARTprintf("+PERF: %s,%lu,%lu,%lu,%lu,%lu/%lu/%lu/%lu/%lu/%lu/%lu/%lu\r\n",
+                   perf_site_name((perf_site_t)site), (unsigned long)p.count,
+                   (unsigned long)p.min, (unsigned long)p.max,
+                   (unsigned long)(p.sum / p.count),
+                   (unsigned long)p.hist[0], (unsigned long)p.hist[1],
+                   (unsigned long)p.hist[2], (unsigned long)p.hist[3],
+                   (unsigned long)p.hist[4], (unsigned long)p.hist[5],
+                   (unsigned long)p.hist[6], (unsigned long)p.hist[7]);
+    }
+    char buf[24];
+    snprintf(buf, sizeof(buf), "CLK=%lu", (unsigned long)SysCtlClockGet());
+    send_ok_data(buf);
+#else
+    (void)param;
+    ack_err(0, "PERF_DISABLED");
+#endif
+}
+
+// AT+JITTER -> one "+JIT: SITE,count,max_us,mean_us,h0/../h15" line per
+// site (bucket k >= 1 counts [2^(k-1), 2^k) us), then "+OK"
+// AT+JITTER=RESET clears all sites
+static void cmd_at_jitter(const char *param) {
+    if (param) {
+        if (strcmp(param, "RESET") != 0) { ack_err(0, "PARAM_ERR"); return; }
+        jitter_reset();
+        send_ok();
+        return;
+    }
+    for (int site = 0; site < JIT_SITE_COUNT; site++) {
+        char line[JITTER_BUCKETS * 11 + 48];
+        jitter_format((jitter_site_t)site, line, sizeof(line));
+        UARTprintf("+JIT: %s\r\n", line);
+    }
+    send_ok();
+}
+
+// AT+UARTSTAT -> RX ring, line error and TX drop counters since boot or last reset
+// AT+UARTSTAT=RESET clears them
+static void cmd_at_uartstat(const char *param) {
+    if (param) {
+        if (strcmp(param, "RESET") != 0) { ack_err(0, "PARAM_ERR"); return; }
+        UART0_ResetRxStats();
+        send_ok();
+        return;
+    }
+    uart_rx_stats_t u;
+    UART0_GetRxStats(&u);
+    char buf[160];
+    snprintf(buf, sizeof(buf), "RX=%lu,OVF=%lu,HWM=%lu,SIZE=%lu,FE=%lu,PE=%lu,BE=%lu,OE=%lu,XOFF=%lu,TXDROP=%lu",
+             (unsigned long)u.bytes, (unsigned long)u.overflows,
+             (unsigned long)u.high_water, (unsigned long)u.size,
+             (unsigned long)u.framing, (unsigned long)u.parity,
+             (unsigned long)u.brk, (unsigned long)u.overrun,
+             (unsigned long)u.xoff, (unsigned long)u.tx_dropped);
+    send_ok_data(buf);
+}
+
+// ---------------------------------------------------------------------------
+// Link rate negotiation
+//   ESP32: AT+BAUD=<rate>   TM4C: +OK: BAUD=<rate>, then switches
+//   ESP32 switches and sends AT+BAUDOK at the new rate -> +OK: BAUD=<rate>
+//   ESP32 confirms with an AT+ECHO round trip
+// Without AT+BAUDOK within BAUD_CONFIRM_MS, or on a burst of framing
+// errors (peer still or again at another rate, e.g. after an ESP32 reset),
+// the TM4C returns to UART_LINK_DEFAULT_BAUD.
+// ---------------------------------------------------------------------------
+static uint32_t g_baud_err_base = 0;
+
+static uint32_t link_line_errors(void) {
+    uart_rx_stats_t u;
+    UART0_GetRxStats(&u);
+    return u.framing + u.brk;
+}
+
+static void baud_fallback(void) {
+    swtimer_cancel(&g_baud_confirm_timer);
+    if (UART0_GetBaud() != UART_LINK_DEFAULT_BAUD) UART0_SetBaud(UART_LINK_DEFAULT_BAUD);
+    g_baud_err_base = link_line_errors();
+}
+
+static void baud_note_good_line(void) {
+    g_baud_err_base = link_line_errors();
+}
+
+static void baud_check_errors(void) {
+    if (UART0_GetBaud() == UART_LINK_DEFAULT_BAUD) return;
+    if (link_line_errors() - g_baud_err_base >= BAUD_FALLBACK_ERRORS) baud_fallback();
+}
+
+static void on_baud_confirm(swtimer_t *t, void *arg) {
+    (void)t; (void)arg;
+    baud_fallback();
+}
+
+static void cmd_at_baud(const char *param) {
+    uint32_t baud = strtoul(param, NULL, 10);
+    if (!UART0_BaudSupported(baud)) { ack_err(0, "PARAM_ERR"); return; }
+    char buf[24];
+    snprintf(buf, sizeof(buf), "BAUD=%lu", (unsigned long)baud);
+    send_ok_data(buf);
+    UART0_SetBaud(baud);
+    g_baud_err_base = link_line_errors();
+    swtimer_arm(&g_baud_confirm_timer, BAUD_CONFIRM_MS, 0);
+}
+
+static void cmd_at_baudok(void) {
+    swtimer_cancel(&g_baud_confirm_timer);
+    char buf[24];
+    snprintf(buf, sizeof(buf), "BAUD=%lu", (unsigned long)UART0_GetBaud());
+    send_ok_data(buf);
+}
+
+// AT+ECHO=<text> -> "+OK: <text>" (link round-trip and throughput checks)
+static void cmd_at_echo(const char *param) {
+    send_ok_data(param);
+}
+
+// Some boards occasionally fail EEPROM init on first boot; retry a few times
+// from a backoff timer instead of spinning.
+static void eeprom_try_init(void) {
+    g_eeprom_attempts++;
+    if (eeprom_config_init()) {
+        eeprom_load_calibration(&g_hx_food, &g_hx_water);
+        eeprom_load_schedule(&S);
+        meal_restore_last();
+        g_boot_count = eeprom_boot_count_increment();
+        // A fresh version range per boot: a version the ESP32 saw before a
+        // reboot can never match the reloaded schedule
+        S.sched_ver = g_boot_count << 16;
+        g_eeprom_ok = true;
+    } else if (g_eeprom_attempts < EEPROM_INIT_ATTEMPTS) {
+        swtimer_arm(&g_eeprom_retry_timer, EEPROM_RETRY_MS, 0);
+    }
+}
+
+// A detected eating session: publish it in state and append it to the log
+static void meal_record(const meal_session_t *m) {
+    uint64_t now_ms = tick_ms();
+    uint32_t dur_s = (uint32_t)((m->end_ms - m->start_ms) / 1000u);
+    uint32_t start_unix = 0;
+    if (S.unix_base > 0) {
+        start_unix = now_unix() - (uint32_t)((now_ms - m->start_ms) / 1000u);
+        format_HHMM(start_unix, S.lastEaten_time);
+    }
+    S.lastEaten_amount = (int)(m->grams + 0.5f);
+    S.lastEaten_duration_s = dur_s;
+    state_changed();
+    evt_post("MEAL,%d,%lu,%s", S.lastEaten_amount, (unsigned long)dur_s, S.lastEaten_time);
+
+    eeprom_meal_t rec;
+    rec.start_unix = start_unix;
+    rec.duration_s = (uint16_t)(dur_s > 0xFFFFu ? 0xFFFFu : dur_s);
+    rec.grams = (uint16_t)S.lastEaten_amount;
+    eeprom_history_append(&rec);
+}
+
+static void meal_restore_last(void) {
+    eeprom_meal_t rec;
+    if (!eeprom_history_get(0, &rec)) return;
+    if (rec.start_unix) format_HHMM(rec.start_unix, S.lastEaten_time);
+    S.lastEaten_amount = rec.grams;
+    S.lastEaten_duration_s = rec.duration_s;
+}
+
+static void pump_set(bool on) {
+    if (on == S.pump_on) return;
+    S.pump_on = on;
+    GPIOPinWrite(GPIO_PORTE_BASE, GPIO_PIN_1, on ? GPIO_PIN_1 : 0);
+    evt_post("PUMP,%d", on ? 1 : 0);
+}
+
+static void alarm_update(int bit, bool on) {
+    int prev = S.alarm;
+    int next = on ? (prev | bit) : (prev & ~bit);
+    if (next == prev) return;
+    state_set_int(&S.alarm, next);
+    if (bit == ALARM_FOOD_SENSOR || bit == ALARM_WATER_SENSOR) {
+        evt_post("SENSOR,%s,%s", bit == ALARM_FOOD_SENSOR ? "FOOD" : "WATER", on ? "TIMEOUT" : "OK");
+    }
+    evt_post("ALARM,%d,%d", next, prev);
+}
+
+// ============================================================================
+// Events
+// ============================================================================
+
+static void evt_post(const char *fmt, ...) {
+    if (g_evt_count == EVT_QUEUE_LEN) {
+        g_evt_count--;          // drop the oldest
+        g_evt_lost++;
+    }
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(g_evt_queue[g_evt_head], EVT_LINE_MAX, fmt, ap);
+    va_end(ap);
+    g_evt_head = (uint8_t)((g_evt_head + 1u) % EVT_QUEUE_LEN);
+    g_evt_count++;
+    if (g_evt_callback) g_evt_callback();
+}
+
+static void evt_flush(void) {
+    if (g_evt_lost) {
+        UARTprintf("+EVT: LOST,%lu\r\n", (unsigned long)g_evt_lost);
+        g_evt_lost = 0;
+    }
+    while (g_evt_count) {
+        uint8_t tail = (uint8_t)((g_evt_head + EVT_QUEUE_LEN - g_evt_count) % EVT_QUEUE_LEN);
+        UARTprintf("+EVT: %s\r\n", g_evt_queue[tail]);
+        g_evt_count--;
     }
-    return false;
+}
+
+static void on_eeprom_retry(swtimer_t *t, void *arg) {
+    (void)t; (void)arg;
+    eeprom_try_init();
+}
+
+static void on_time_request(swtimer_t *t, void *arg) {
+    (void)t; (void)arg;
+    UARTprintf("AT+GETTIME\r\n");
 }
 
 // ============================================================================
 // Helpers
 // ============================================================================
-
-static inline uint32_t deg_to_steps(uint32_t deg)
-{
-    const uint32_t steps_per_rev = (uint32_t)STEPPER_HALFSTEP_STEPS_PER_REV;
-    uint64_t num = (uint64_t)deg * (uint64_t)steps_per_rev + 180u;
-    return (uint32_t)(num / 360u);
-}
-
-static bool is_amount_LMH(const char *s) {
-    if (!s || strlen(s) < 1) return false;
-    return (s[0]=='L'||s[0]=='M'||s[0]=='H');
-}
-
-static int level_to_grams(const char *level) {
-    if (!level) return 0;
-    switch (level[0]) {
-        case 'L': return 10;
-        case 'M': return 25;
-        case 'H': return 40;
-        default: return 0;
-    }
-}
-
-static uint32_t now_unix(void) {
-    uint32_t elapsed_ms = millis() - S.ms_at_sync;
-    return S.unix_base + (elapsed_ms / 1000u);
-}
-
-static void format_HHMM(uint32_t unix_sec, char out[6]) {
-    uint32_t sec_in_day = unix_sec % 86400u;
-    uint32_t hh = (sec_in_day / 3600u) % 24u;
-    uint32_t mm = (sec_in_day % 3600u) / 60u;
-    snprintf(out, 6, "%02u:%02u", hh, mm);
-}
-
-// ============================================================================
-// Time Utility Functions (formerly from rtc_ds3231.c)
-// ============================================================================
-
-static bool is_leap_year(uint32_t year)
-{
-    return (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
-}
-
-static uint8_t calculate_weekday(uint32_t year, uint8_t month, uint8_t day)
-{
-    // Zeller's congruence for Gregorian calendar
-    // Returns 1=Sunday, 2=Monday, ..., 7=Saturday
-    if (month < 3) {
-        month += 12;
-        year--;
-    }
-    uint32_t K = year % 100;
-    uint32_t J = year / 100;
-    uint32_t h = (day + (13 * (month + 1)) / 5 + K + K / 4 + J / 4 - 2 * J) % 7;
-    // Zeller gives 0=Saturday, 1=Sunday, ..., 6=Friday
-    // Convert to 1=Sunday, 2=Monday, ..., 7=Saturday
-    uint8_t weekday = (uint8_t)((h + 6) % 7 + 1);
-    return weekday;
-}
-
-uint32_t rtc_time_to_unix(const rtc_time_t *t)
-{
-    if (!t) return 0;
-    if (t->year < 1970 || t->year > 2099) return 0;
-    if (t->month < 1 || t->month > 12) return 0;
-    if (t->date < 1 || t->date > 31) return 0;
-    if (t->hour > 23 || t->min > 59 || t->sec > 59) return 0;
-
-    // Days in each month (non-leap year)
-    const uint8_t days_in_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-
-    // Count days from 1970-01-01 to target date
-    uint32_t days = 0;
-
-    // Add days for complete years from 1970 to (year-1)
-    for (uint32_t y = 1970; y < t->year; y++) {
-        days += is_leap_year(y) ? 366 : 365;
-    }
-
-    // Add days for complete months in current year
-    for (uint8_t m = 1; m < t->month; m++) {
-        if (m == 2 && is_leap_year(t->year)) {
-            days += 29;
-        } else {
-            days += days_in_month[m - 1];
-        }
-    }
-
-    // Add days in current month
-    days += t->date - 1;
-
-    // Convert to seconds
-    uint32_t unix_time = days * 86400UL;
-    unix_time += (uint32_t)t->hour * 3600UL;
-    unix_time += (uint32_t)t->min * 60UL;
-    unix_time += (uint32_t)t->sec;
-
-    return unix_time;
-}
-
-bool rtc_unix_to_time(uint32_t unix_sec, rtc_time_t *t)
-{
-    if (!t) return false;
-
-    // Constants
-    const uint32_t SECONDS_PER_DAY = 86400UL;
-    const uint8_t days_in_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-
-    // Calculate days since Unix epoch and seconds within day
-    uint32_t days = unix_sec / SECONDS_PER_DAY;
-    uint32_t sec_in_day = unix_sec % SECONDS_PER_DAY;
-
-    // Find year
-    uint32_t year = 1970;
-    uint32_t days_counted = 0;
-
-    while (1) {
-        uint32_t days_in_year = is_leap_year(year) ? 366 : 365;
-        if (days_counted + days_in_year > days) {
-            break; // Found the year
-        }
-        days_counted += days_in_year;
-        year++;
-    }
-
-    // Days remaining in current year
-    uint32_t day_of_year = days - days_counted;
-
-    // Find month and day
-    uint8_t month = 1;
-    uint8_t feb_days = is_leap_year(year) ? 29 : 28;
-
-    for (month = 1; month <= 12; month++) {
-        uint8_t days_this_month = (month == 2) ? feb_days : days_in_month[month - 1];
-        if (day_of_year < days_this_month) {
-            break;
-        }
-        day_of_year -= days_this_month;
-    }
-
-    uint8_t day = (uint8_t)(day_of_year + 1);
-
-    // Extract time of day
-    t->year = (uint16_t)year;
-    t->month = month;
-    t->date = day;
-    t->hour = (uint8_t)(sec_in_day / 3600);
-    t->min = (uint8_t)((sec_in_day % 3600) / 60);
-    t->sec = (uint8_t)(sec_in_day % 60);
-
-    // Calculate weekday
-    t->weekday = calculate_weekday(year, month, day);
-
-    return true;
-}
+
+static inline uint32_t deg_to_steps(uint32_t deg)
+{
+    const uint32_t steps_per_rev = (uint32_t)STEPPER_HALFSTEP_STEPS_PER_REV;
+    uint64_t num = (uint64_t)deg * (uint64_t)steps_per_rev + 180u;
+    return (uint32_t)(num / 360u);
+}
+
+// Start background feeding: one half-step per timer expiry, with a
+// deadline timer as a safety stop
+static void feed_start(char level, uint32_t steps) {
+    if (steps > MAX_FEED_STEPS) steps = MAX_FEED_STEPS;
+    S.feed_steps_remaining = steps;
+    S.feed_steps_total = steps;
+    S.feed_step_delay_ms = FEED_STEP_DELAY_MS;
+    S.feed_last_amount_g = level_to_grams(&level);
+    S.busy = true;
+    state_changed();
+    evt_post("FEED,START,%c,%d", level, S.feed_last_amount_g);
+    swtimer_arm(&g_feed_deadline_timer, steps * S.feed_step_delay_ms + 1000u, 0);
+    swtimer_arm(&g_feed_step_timer, 0, S.feed_step_delay_ms);
+}
+
+static void feed_finish(void) {
+    swtimer_cancel(&g_feed_step_timer);
+    swtimer_cancel(&g_feed_deadline_timer);
+    S.feed_steps_remaining = 0;
+    S.busy = false;
+    state_changed();
+    if (S.unix_base > 0) {
+        format_HHMM(now_unix(), S.lastFed_time);
+    }
+    S.lastFed_amount = S.feed_last_amount_g;
+    stepper_uln2003_all_off();
+    evt_post("FEED,DONE,%d,%s", S.lastFed_amount, S.lastFed_time);
+}
+
+static void on_feed_step(swtimer_t *t, void *arg) {
+    (void)arg;
+    if (S.feed_steps_remaining > 0) {
+        jitter_record(JIT_STEP_LATE, (uint32_t)(tick_us() - swtimer_due_ms(t) * 1000u));
+        PERF_BEGIN(t_step);
+        stepper_uln2003_step(+1);
+        PERF_END(PERF_STEP, t_step);
+        S.feed_steps_remaining--;
+    }
+    if (S.feed_steps_remaining == 0) feed_finish();
+}
+
+static void on_feed_deadline(swtimer_t *t, void *arg) {
+    (void)t; (void)arg;
+    feed_finish();
+}
+
+static bool is_amount_LMH(const char *s) {
+    if (!s || strlen(s) < 1) return false;
+    return (s[0]=='L'||s[0]=='M'||s[0]=='H');
+}
+
+static int level_to_grams(const char *level) {
+    if (!level) return 0;
+    switch (level[0]) {
+        case 'L': return 10;
+        case 'M': return 25;
+        case 'H': return 40;
+        default: return 0;
+    }
+}
+
+static uint32_t now_unix(void) {
+    uint64_t elapsed_ms = tick_ms() - S.ms_at_sync;
+    return S.unix_base + (uint32_t)(elapsed_ms / 1000u);
+}
+
+static void format_HHMM(uint32_t unix_sec, char out[6]) {
+    uint32_t sec_in_day = unix_sec % 86400u;
+    uint32_t hh = (sec_in_day / 3600u) % 24u;
+    uint32_t mm = (sec_in_day % 3600u) / 60u;
+    snprintf(out, 6, "%02u:%02u", hh, mm);
+}
+
+// ============================================================================
+// Time Utility Functions (formerly from rtc_ds3231.c)
+// ============================================================================
+
+static bool is_leap_year(uint32_t year)
+{
+    return (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
+}
+
+static uint8_t calculate_weekday(uint32_t year, uint8_t month, uint8_t day)
+{
+    // Zeller's congruence for Gregorian calendar
+    // Returns 1=Sunday, 2=Monday, ..., 7=Saturday
+    if (month < 3) {
+        month += 12;
+        year--;
+    }
+    uint32_t K = year % 100;
+    uint32_t J = year / 100;
+    uint32_t h = (day + (13 * (month + 1)) / 5 + K + K / 4 + J / 4 - 2 * J) % 7;
+    // Zeller gives 0=Saturday, 1=Sunday, ..., 6=Friday
+    // Convert to 1=Sunday, 2=Monday, ..., 7=Saturday
+    uint8_t weekday = (uint8_t)((h + 6) % 7 + 1);
+    return weekday;
+}
+
+uint32_t rtc_time_to_unix(const rtc_time_t *t)
+{
+    if (!t) return 0;
+    if (t->year < 1970 || t->year > 2099) return 0;
+    if (t->month < 1 || t->month > 12) return 0;
+    if (t->date < 1 || t->date > 31) return 0;
+    if (t->hour > 23 || t->min > 59 || t->sec > 59) return 0;
+
+    // Days in each month (non-leap year)
+    const uint8_t days_in_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+    // Count days from 1970-01-01 to target date
+    uint32_t days = 0;
+
+    // Add days for complete years from 1970 to (year-1)
+    for (uint32_t y = 1970; y < t->year; y++) {
+        days += is_leap_year(y) ? 366 : 365;
+    }
+
+    // Add days for complete months in current year
+    for (uint8_t m = 1; m < t->month; m++) {
+        if (m == 2 && is_leap_year(t->year)) {
+            days += 29;
+        } else {
+            days += days_in_month[m - 1];
+        }
+    }
+
+    // Add days in current month
+    days += t->date - 1;
+
+    // Convert to seconds
+    uint32_t unix_time = days * 86400UL;
+    unix_time += (uint32_t)t->hour * 3600UL;
+    unix_time += (uint32_t)t->min * 60UL;
+    unix_time += (uint32_t)t->sec;
+
+    return unix_time;
+}
+
+bool rtc_unix_to_time(uint32_t unix_sec, rtc_time_t *t)
+{
+    if (!t) return false;
+
+    // Constants
+    const uint32_t SECONDS_PER_DAY = 86400UL;
+    const uint8_t days_in_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+    // Calculate days since Unix epoch and seconds within day
+    uint32_t days = unix_sec / SECONDS_PER_DAY;
+    uint32_t sec_in_day = unix_sec % SECONDS_PER_DAY;
+
+    // Find year
+    uint32_t year = 1970;
+    uint32_t days_counted = 0;
+
+    while (1) {
+        uint32_t days_in_year = is_leap_year(year) ? 366 : 365;
+        if (days_counted + days_in_year > days) {
+            break; // Found the year
+        }
+        days_counted += days_in_year;
+        year++;
+    }
+
+    // Days remaining in current year
+    uint32_t day_of_year = days - days_counted;
+
+    // Find month and day
+    uint8_t month = 1;
+    uint8_t feb_days = is_leap_year(year) ? 29 : 28;
+
+    for (month = 1; month <= 12; month++) {
+        uint8_t days_this_month = (month == 2) ? feb_days : days_in_month[month - 1];
+        if (day_of_year < days_this_month) {
+            break;
+        }
+        day_of_year -= days_this_month;
+    }
+
+    uint8_t day = (uint8_t)(day_of_year + 1);
+
+    // Extract time of day
+    t->year = (uint16_t)year;
+    t->month = month;
+    t->date = day;
+    t->hour = (uint8_t)(sec_in_day / 3600);
+    t->min = (uint8_t)((sec_in_day % 3600) / 60);
+    t->sec = (uint8_t)(sec_in_day % 60);
+
+    // Calculate weekday
+    t->weekday = calculate_weekday(year, month, day);
+
+    return true;
+}
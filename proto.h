@@ -15,11 +15,17 @@ typedef struct {
     uint8_t  sec;   // 0..59
 } rtc_time_t;
 
+// Firmware version reported by AT+SNAPSHOT (override from the build)
+#ifndef FW_VERSION
+#define FW_VERSION "1.1.0"
+#endif
+
 // Public API
 void Proto_Init(void);
 void Proto_Poll(void);
-// 10ms periodic tick (non-blocking actuator scheduling)
-void Proto_Tick10ms(void);
+// Called when an unsolicited +EVT line is queued, so the owner can run
+// Proto_Poll() (which writes it once no reply is pending). NULL disables it.
+void Proto_SetEventCallback(void (*cb)(void));
 // 100ms periodic tick (sensor sampling/filtering)
 void Proto_Tick100ms(void);
 // 1000ms periodic tick (schedule checking)
@@ -32,6 +38,17 @@ typedef struct {
     int alarm; // 0/bitmask
 } StatusSnapshot;
 
+// Alarm bits (ProtoState.alarm, ALARM= in AT+STATUS)
+#define ALARM_WATER_LOW     0x01  // water below WATER_LOW_G, pump running
+#define ALARM_FOOD_SENSOR   0x02  // no food HX711 reading for SENSOR_STALE_MS
+#define ALARM_WATER_SENSOR  0x04  // no water HX711 reading for SENSOR_STALE_MS
+
+// Health bits (AT+STATUS2)
+#define HEALTH_FOOD_SENSOR  0x01  // food HX711 reading within SENSOR_STALE_MS
+#define HEALTH_WATER_SENSOR 0x02
+#define HEALTH_TIME_SYNCED  0x04  // AT+SETTIME received
+#define HEALTH_EEPROM       0x08  // EEPROM initialised
+
 void Proto_GetStatus(StatusSnapshot *out);
 
 // ============================================================================
@@ -55,27 +72,32 @@ typedef struct ProtoState_t {
     // lastFed/Eaten
     char lastFed_time[6];  // "HH:MM" or "--:--"
     int  lastFed_amount;   // grams
-    char lastEaten_time[6];
-    int  lastEaten_amount;
+    char lastEaten_time[6];   // session start, "HH:MM" or "--:--"
+    int  lastEaten_amount;    // grams
+    uint32_t lastEaten_duration_s;
     
     // schedule entries
     struct { uint8_t hh, mm; char amount; uint8_t en; } sched[8];
     uint8_t sched_len;
+    uint32_t sched_ver;    // bumped on every change; AT+SCHEDADD/DEL/SET must quote it.
+                           // Starts at boot_count << 16 so it never repeats across reboots
     
     // time sync (ESP32 NTP-based)
     uint32_t unix_base;    // at last sync (timezone already applied)
-    uint32_t ms_at_sync;   // ms counter at last sync
+    uint64_t ms_at_sync;   // tick_ms() at last sync
     bool time_request_pending;     // waiting for ESP32 time reply
-    uint32_t time_request_last_ms; // last time request timestamp (for retry)
 
     // busy flag for FEED_NOW
     bool busy;
+    bool pump_on;
+
+    // bumped on any change visible in AT+STATUS / AT+LOG (see AT+STATUS?<gen>)
+    uint32_t gen;
 
-    // feed task state (background stepping)
+    // feed task state (background stepping, driven by software timers)
     uint32_t feed_steps_remaining;
+    uint32_t feed_steps_total;
     uint32_t feed_step_delay_ms;
-    uint32_t feed_next_step_ms;
-    uint32_t feed_deadline_ms;
     int      feed_last_amount_g;
 
     // schedule tracking
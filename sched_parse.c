@@ -0,0 +1,108 @@
+#include "sched_parse.h"
+
+#include <string.h>
+
+// Legacy "HH:MM,A,E" sub-states
+enum { LG_HH = 0, LG_SEEK_COLON, LG_MM, LG_SEEK_COMMA, LG_AMT, LG_DONE };
+
+static inline bool is_digit(char c) { return c >= '0' && c <= '9'; }
+static inline bool is_amount(char c) { return c == 'L' || c == 'M' || c == 'H'; }
+
+static void token_reset(sched_parser_t *p)
+{
+    p->t_len = 0;
+    p->last = 0;
+    p->digits = 0;
+    p->hhmm = 0;
+    p->lg = LG_HH;
+    p->lg_hh = 0;
+    p->lg_mm = 0;
+    p->lg_amt = 0;
+}
+
+// Validate the finished token and append it
+static void token_end(sched_parser_t *p)
+{
+    if (p->t_len == 0) return;           // empty token (";;") is ignored
+    if (p->tokens >= SCHED_PARSE_MAX_TOKENS) return;
+    p->tokens++;
+    if (p->len >= SCHED_PARSE_MAX) { token_reset(p); return; }
+
+    uint16_t hh = 0, mm = 0;
+    char amt = 0;
+    bool parsed = false;
+    if (p->t_len >= 5 && is_amount(p->last) && p->digits == 4) {
+        hh = p->hhmm / 100u;
+        mm = p->hhmm % 100u;
+        amt = p->last;
+        parsed = true;
+    } else if (p->lg == LG_DONE && is_amount(p->lg_amt)) {
+        hh = p->lg_hh;
+        mm = p->lg_mm;
+        amt = p->lg_amt;
+        parsed = true;
+    }
+    if (parsed && hh <= 23 && mm <= 59) {
+        sched_entry_t *e = &p->entries[p->len++];
+        e->hh = (uint8_t)hh;
+        e->mm = (uint8_t)mm;
+        e->amount = amt;
+    }
+    token_reset(p);
+}
+
+void sched_parse_begin(sched_parser_t *p)
+{
+    memset(p, 0, sizeof(*p));
+    token_reset(p);
+}
+
+void sched_parse_feed(sched_parser_t *p, char c)
+{
+    if (p->total < 0xFFFFu) p->total++;
+    if (p->none_match < 4 && p->total == p->none_match + 1u && c == "NONE"[p->none_match]) {
+        p->none_match++;
+    }
+
+    if (c == ';') { token_end(p); return; }
+
+    if (p->t_len < 0xFFu) p->t_len++;
+    p->last = c;
+
+    if (is_digit(c) && p->digits < 4) {
+        p->hhmm = (uint16_t)(p->hhmm * 10u + (uint16_t)(c - '0'));
+        p->digits++;
+    }
+
+    // Values saturate at 999 so range checks still reject them
+    switch (p->lg) {
+    case LG_HH:
+        if (is_digit(c)) { if (p->lg_hh < 999u) p->lg_hh = (uint16_t)(p->lg_hh * 10u + (uint16_t)(c - '0')); }
+        else p->lg = (c == ':') ? LG_MM : LG_SEEK_COLON;
+        break;
+    case LG_SEEK_COLON:
+        if (c == ':') p->lg = LG_MM;
+        break;
+    case LG_MM:
+        if (is_digit(c)) { if (p->lg_mm < 999u) p->lg_mm = (uint16_t)(p->lg_mm * 10u + (uint16_t)(c - '0')); }
+        else p->lg = (c == ',') ? LG_AMT : LG_SEEK_COMMA;
+        break;
+    case LG_SEEK_COMMA:
+        if (c == ',') p->lg = LG_AMT;
+        break;
+    case LG_AMT:
+        p->lg_amt = c;
+        p->lg = LG_DONE;
+        break;
+    default:
+        break;
+    }
+}
+
+sched_parse_result_t sched_parse_end(sched_parser_t *p)
+{
+    if (p->total == 0) return SCHED_PARSE_EMPTY;
+    if (p->total == 4 && p->none_match == 4) return SCHED_PARSE_NONE;
+    token_end(p);
+    return SCHED_PARSE_LIST;
+}
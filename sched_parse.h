@@ -0,0 +1,53 @@
+#ifndef USER_SCHED_PARSE_H
+#define USER_SCHED_PARSE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Single-pass parser for the AT+SCHED= parameter, fed one byte at a time
+// as it arrives from the UART. Nothing is buffered: each ';'-separated
+// entry is validated as it ends and appended to a private list. The
+// caller copies the list into the live schedule only at end of line, so
+// a line that never completes leaves the schedule unchanged.
+//
+// Accepted entry formats (invalid entries are skipped, like before):
+//   "HHMMA"       e.g. "0700M"  (first 4 digits, amount is the last char)
+//   "HH:MM,A,E"   legacy
+// The whole parameter "NONE" clears the schedule.
+
+#define SCHED_PARSE_MAX 8
+#define SCHED_PARSE_MAX_TOKENS 16   // safety limit, as in the old strtok loop
+
+typedef struct {
+    uint8_t hh, mm;
+    char amount;            // 'L', 'M' or 'H'
+} sched_entry_t;
+
+typedef enum {
+    SCHED_PARSE_LIST = 0,   // entries[0..len) holds the new schedule
+    SCHED_PARSE_NONE,       // "NONE": clear the schedule
+    SCHED_PARSE_EMPTY       // no parameter at all
+} sched_parse_result_t;
+
+typedef struct {
+    sched_entry_t entries[SCHED_PARSE_MAX];
+    uint8_t len;
+    uint8_t tokens;         // non-empty tokens seen
+    uint16_t total;         // parameter bytes seen (saturating)
+    uint8_t none_match;     // prefix of "NONE" matched so far
+
+    // current token
+    uint8_t t_len;          // saturating
+    char last;
+    uint8_t digits;         // "HHMMA": digits collected (max 4)
+    uint16_t hhmm;
+    uint8_t lg;             // legacy sub-state
+    uint16_t lg_hh, lg_mm;
+    char lg_amt;
+} sched_parser_t;
+
+void sched_parse_begin(sched_parser_t *p);
+void sched_parse_feed(sched_parser_t *p, char c);
+sched_parse_result_t sched_parse_end(sched_parser_t *p);
+
+#endif // USER_SCHED_PARSE_H
@@ -0,0 +1,178 @@
+// Host run of the TM4C scheduler, timer wheel and UART driver that reports
+// the lateness histograms AT+JITTER would return.
+//
+// tick.c, task.c, swtimer.c, jitter.c, uart.c and spsc_ring.c are the
+// firmware sources, unchanged. The task bodies are stand-ins with fixed
+// costs (below) for the work Proto_Poll, Proto_Tick100ms and
+// Proto_Tick1000ms do, plus a feed in progress stepping every
+// FEED_STEP_DELAY_MS. The ESP32 side polls over the simulated link.
+//
+//   ./jitter_sim [seconds]     default 20 simulated seconds
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sim_hw.h"
+#include "sim_uart.h"
+
+#include "driverlib/systick.h"
+#include "jitter.h"
+#include "proto.h"
+#include "swtimer.h"
+#include "task.h"
+#include "tick.h"
+#include "uart.h"
+
+#define US(n) ((uint32_t)((n) * (SIM_CPU_HZ / 1000000u)))
+
+// Model costs
+#define CMD_CYCLES        US(150)    // parse and handle one AT line
+#define SENSE_CYCLES      US(1200)   // two HX711 reads and filtering
+#define SCHED_CYCLES      US(80)     // schedule check
+#define STEP_CYCLES       US(6)      // one stepper half-step
+#define IDLE_CYCLES       US(2)      // main loop spin with nothing ready
+
+// ESP32 traffic
+// The ESP32 clock is not locked to ours, so the poll period is not a
+// whole number of our milliseconds
+#define POLL_CYCLES       (US(250000) + US(37))
+#define POLL_LINE         "AT+STATUS2\r\n"
+#define SCHED_EVERY_POLLS 20u
+#define SCHED_LINE        "AT+SCHED=0700M;1200L;1830H;2100L\r\n"
+#define REPLY             "+OK: 1,0,512,120,350,1,0,1700000000,0,0,0,0,0,0\r\n"
+// The ESP32 pauses our output twice: once with a prompt XON, once with
+// the XON lost on the wire
+#define XOFF_AT_MS        10000u
+#define XON_AFTER_MS      150u
+#define LOST_XOFF_AT_MS   15000u
+
+// No step may be held off longer than the slowest task (SENSE) plus margin
+#define STEP_LATE_MAX_US  2000u
+
+enum { TASK_TIMER = 0, TASK_UART, TASK_SENSORS, TASK_SCHEDULE };
+
+static swtimer_t g_step_timer;
+static uint32_t g_lines;
+
+static void systick_handler(void)
+{
+    tick_isr();
+    task_tick_isr();
+    if (swtimer_tick_isr()) task_post(TASK_TIMER);
+}
+
+static void timer_kick(void)
+{
+    task_post(TASK_TIMER);
+}
+
+static void uart_rx_notify(void)
+{
+    task_post(TASK_UART);
+}
+
+// Same measurement as on_feed_step() in proto.c
+static void on_step(swtimer_t *t, void *arg)
+{
+    (void)arg;
+    jitter_record(JIT_STEP_LATE, (uint32_t)(tick_us() - swtimer_due_ms(t) * 1000u));
+    sim_advance(STEP_CYCLES);
+}
+
+static void uart_task(void)
+{
+    char c;
+    while (UART0_ReadChar(&c)) {
+        if (c != '\n') continue;
+        g_lines++;
+        sim_advance(CMD_CYCLES);
+        UARTprintf(REPLY);
+    }
+}
+
+static void sense_task(void)
+{
+    sim_advance(SENSE_CYCLES);
+}
+
+static void sched_task(void)
+{
+    sim_advance(SCHED_CYCLES);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t seconds = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 10) : 20u;
+    if (!seconds) seconds = 20u;
+
+    tick_init();
+    SysTickIntRegister(systick_handler);
+    UART0_ConsoleInit(UART_LINK_DEFAULT_BAUD);
+    swtimer_service_init(timer_kick);
+
+    task_create("TIMER", swtimer_run, TASK_TIMER,    0u,    2u);
+    task_create("UART",  uart_task,   TASK_UART,     0u,    10u);
+    task_create("SENSE", sense_task,  TASK_SENSORS,  100u,  0u);
+    task_create("SCHED", sched_task,  TASK_SCHEDULE, 1000u, 0u);
+    UART0_SetRxCallback(uart_rx_notify);
+
+    swtimer_init(&g_step_timer, on_step, NULL);
+    swtimer_arm(&g_step_timer, 0u, FEED_STEP_DELAY_MS);
+
+    uint64_t end_ms = tick_ms() + (uint64_t)seconds * 1000u;
+    uint64_t next_poll = sim_cycles() + POLL_CYCLES;
+    uint64_t start_ms = tick_ms();
+    uint32_t polls = 0;
+    int flow_step = 0;
+    while (tick_ms() < end_ms) {
+        uint64_t at = tick_ms() - start_ms;
+        if (flow_step == 0 && at >= XOFF_AT_MS) {
+            sim_uart_send("\x13", 1u);
+            flow_step++;
+        } else if (flow_step == 1 && at >= XOFF_AT_MS + XON_AFTER_MS) {
+            sim_uart_send("\x11", 1u);
+            flow_step++;
+        } else if (flow_step == 2 && at >= LOST_XOFF_AT_MS) {
+            sim_uart_send("\x13", 1u);
+            flow_step++;
+        }
+        if (sim_cycles() >= next_poll) {
+            next_poll += POLL_CYCLES;
+            if (++polls % SCHED_EVERY_POLLS == 0) {
+                sim_uart_send(SCHED_LINE, sizeof(SCHED_LINE) - 1u);
+            } else {
+                sim_uart_send(POLL_LINE, sizeof(POLL_LINE) - 1u);
+            }
+        }
+        if (!task_run_next()) sim_advance(IDLE_CYCLES);
+    }
+
+    printf("simulated %" PRIu32 " s at %" PRIu32 " baud: %" PRIu32 " lines in, %" PRIu32 " bytes out\n",
+           seconds, UART0_GetBaud(), g_lines, sim_uart_tx_count());
+    for (int site = 0; site < JIT_SITE_COUNT; site++) {
+        char line[JITTER_BUCKETS * 11 + 48];
+        jitter_format((jitter_site_t)site, line, sizeof(line));
+        printf("+JIT: %s\n", line);
+    }
+
+    // Every site must have samples, and none may be a wrapped negative
+    int rc = 0;
+    jitter_stats_t step;
+    jitter_get(JIT_STEP_LATE, &step);
+    if (step.max_us >= STEP_LATE_MAX_US) {
+        fprintf(stderr, "jitter_sim: a step was %" PRIu32 " us late\n", step.max_us);
+        rc = 1;
+    }
+    for (int site = 0; site < JIT_SITE_COUNT; site++) {
+        jitter_stats_t j;
+        jitter_get((jitter_site_t)site, &j);
+        if (j.count == 0 || j.max_us >= 1000000u) {
+            fprintf(stderr, "jitter_sim: %s has no or implausible samples\n",
+                    jitter_site_name((jitter_site_t)site));
+            rc = 1;
+        }
+    }
+    if (!rc) printf("jitter_sim: ok\n");
+    return rc;
+}
@@ -0,0 +1,182 @@
+// Host check of the meal session detector (meal_detect.c).
+//
+// Synthetic bowl-weight traces are fed at the 100 ms sensor rate of
+// Proto_Tick100ms: a feed step-up, a gradual eating session, a session cut
+// short by a feed, and a long stretch of noise with slow drift. Each
+// checks when the detector enters MEAL_ST_EATING (session start) and when
+// meal_detect_update() reports the session (done), with its grams and
+// duration.
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "meal_detect.h"
+
+#define SAMPLE_MS   100u
+#define NOISE_G     1.0f      // peak sample noise of a settled HX711 reading
+
+static unsigned g_checks;
+
+#define CHECK(cond) do { \
+        g_checks++; \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+typedef struct {
+    meal_detect_t md;
+    uint64_t now_ms;
+    uint32_t rng;
+    uint32_t starts;          // entries into MEAL_ST_EATING
+    uint64_t start_seen_ms;   // when the last one happened
+    uint32_t sessions;        // sessions reported
+    uint64_t done_ms;         // when the last one was reported
+    meal_session_t last;
+} trace_t;
+
+static void trace_init(trace_t *t, uint32_t seed)
+{
+    meal_detect_init(&t->md);
+    t->now_ms = 123456789u;   // arbitrary tick_ms() at the start
+    t->rng = seed;
+    t->starts = 0;
+    t->start_seen_ms = 0;
+    t->sessions = 0;
+    t->done_ms = 0;
+}
+
+// Uniform in [-amp, amp], deterministic per seed
+static float noise(trace_t *t, float amp)
+{
+    t->rng = t->rng * 1664525u + 1013904223u;
+    return amp * ((float)(t->rng >> 8) / 8388608.0f - 1.0f);
+}
+
+static void sample(trace_t *t, float grams, bool feeding)
+{
+    meal_state_t before = t->md.state;
+    meal_session_t m;
+    if (meal_detect_update(&t->md, grams, feeding, t->now_ms, &m)) {
+        t->sessions++;
+        t->done_ms = t->now_ms;
+        t->last = m;
+    }
+    if (t->md.state == MEAL_ST_EATING && before != MEAL_ST_EATING) {
+        t->starts++;
+        t->start_seen_ms = t->now_ms;
+    }
+    t->now_ms += SAMPLE_MS;
+}
+
+// Linear from 'from' to 'to' over 'ms', plus noise
+static void ramp(trace_t *t, float from, float to, uint32_t ms, bool feeding)
+{
+    uint32_t n = ms / SAMPLE_MS;
+    for (uint32_t i = 0; i < n; i++) {
+        sample(t, from + (to - from) * (float)i / (float)n + noise(t, NOISE_G), feeding);
+    }
+}
+
+static void hold(trace_t *t, float grams, uint32_t ms)
+{
+    ramp(t, grams, grams, ms, false);
+}
+
+static double secs(uint64_t ms)
+{
+    return (double)ms / 1000.0;
+}
+
+// The auger adds 30 g over 5 s. The step-up happens while 'feeding' and
+// the reading settles afterwards: no session, and the reference follows.
+static void check_feed_step(void)
+{
+    trace_t t;
+    trace_init(&t, 1u);
+    hold(&t, 50.0f, 30000u);
+    CHECK(t.md.state == MEAL_ST_IDLE);
+    ramp(&t, 50.0f, 80.0f, 5000u, true);
+    CHECK(t.md.state == MEAL_ST_FEEDING);
+    hold(&t, 80.0f, 180000u);
+    CHECK(t.md.state == MEAL_ST_IDLE);
+    CHECK(t.starts == 0);
+    CHECK(t.sessions == 0);
+    CHECK(t.md.ref > 78.0f && t.md.ref < 82.0f);
+    printf("feed step: no session, reference %.1f g\n", t.md.ref);
+}
+
+// 15 g eaten over 90 s at a steady pace, then the bowl is left alone. The
+// start is detected within seconds, dated back to where the decrease
+// began, and the session is reported MEAL_END_QUIET_MS after the last drop.
+static void check_gradual_session(void)
+{
+    trace_t t;
+    trace_init(&t, 2u);
+    hold(&t, 80.0f, 60000u);
+    const uint64_t eat_start = t.now_ms;
+    ramp(&t, 80.0f, 65.0f, 90000u, false);
+    const uint64_t eat_end = t.now_ms;
+    hold(&t, 65.0f, 120000u);
+
+    CHECK(t.starts == 1);
+    CHECK(t.start_seen_ms > eat_start && t.start_seen_ms - eat_start < 20000u);
+    CHECK(t.sessions == 1);
+    CHECK(t.md.state == MEAL_ST_IDLE);
+    CHECK(t.last.grams > 13.5f && t.last.grams < 16.5f);
+    CHECK(t.last.start_ms + 10000u > eat_start && t.last.start_ms < eat_start + 10000u);
+    CHECK(t.last.end_ms + 10000u > eat_end && t.last.end_ms < eat_end + 5000u);
+    CHECK(t.done_ms - t.last.end_ms >= MEAL_END_QUIET_MS);
+    CHECK(t.done_ms - t.last.end_ms < MEAL_END_QUIET_MS + 1000u);
+    printf("gradual session: start seen after %.1f s, done %.1f s after the last bite, "
+           "%.1f g over %.1f s (start %+.1f s)\n",
+           secs(t.start_seen_ms - eat_start), secs(t.done_ms - eat_end), t.last.grams,
+           secs(t.last.end_ms - t.last.start_ms),
+           (double)((int64_t)t.last.start_ms - (int64_t)eat_start) / 1000.0);
+}
+
+// A feed during a session ends it right away with what was eaten so far
+static void check_session_cut_by_feed(void)
+{
+    trace_t t;
+    trace_init(&t, 3u);
+    hold(&t, 60.0f, 60000u);
+    ramp(&t, 60.0f, 50.0f, 40000u, false);
+    CHECK(t.md.state == MEAL_ST_EATING);
+    CHECK(t.sessions == 0);
+    const uint64_t feed_at = t.now_ms;
+    ramp(&t, 50.0f, 80.0f, 5000u, true);
+    CHECK(t.sessions == 1);
+    CHECK(t.done_ms == feed_at);
+    CHECK(t.last.grams > 8.5f && t.last.grams < 11.5f);
+    hold(&t, 80.0f, 120000u);
+    CHECK(t.sessions == 1);
+    CHECK(t.starts == 1);
+    printf("session cut by feed: %.1f g reported at the feed\n", t.last.grams);
+}
+
+// Ten minutes of sample noise and 2 g of slow drift down (creep,
+// temperature): never a session start
+static void check_noise(void)
+{
+    trace_t t;
+    trace_init(&t, 4u);
+    hold(&t, 70.0f, 10000u);
+    ramp(&t, 70.0f, 68.0f, 600000u, false);
+    CHECK(t.starts == 0);
+    CHECK(t.sessions == 0);
+    CHECK(t.md.state == MEAL_ST_IDLE);
+    printf("noise and drift: no session, reference %.1f g\n", t.md.ref);
+}
+
+int main(void)
+{
+    check_feed_step();
+    check_gradual_session();
+    check_session_cut_by_feed();
+    check_noise();
+    printf("meal_sim: ok (%u checks)\n", g_checks);
+    return 0;
+}
@@ -0,0 +1,194 @@
+#include "sim_hw.h"
+
+#include "inc/hw_nvic.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/systick.h"
+
+#define SIM_EVENTS 8
+
+typedef struct {
+    uint64_t at;
+    void (*fn)(void);
+} sim_event_t;
+
+static uint64_t g_cycles;
+static uint32_t g_st_period = 1u;
+static uint32_t g_st_val;
+static bool g_masked;
+static uint32_t g_pending;             // bit per sim_irq_t
+static void (*g_handlers[SIM_IRQ_COUNT])(void);
+static sim_event_t g_events[SIM_EVENTS];
+static volatile uint32_t g_int_ctrl;
+static volatile uint32_t g_scratch_reg;
+
+static void service(void)
+{
+    while (g_pending && !g_masked) {
+        sim_irq_t irq = (sim_irq_t)__builtin_ctz(g_pending);
+        g_pending &= ~(1u << irq);
+        if (!g_handlers[irq]) continue;
+        g_masked = true;
+        g_handlers[irq]();
+        g_masked = false;
+    }
+}
+
+// Cycles until the next due event (UINT64_MAX if none)
+static uint64_t next_event_in(void)
+{
+    uint64_t best = UINT64_MAX;
+    for (int i = 0; i < SIM_EVENTS; i++) {
+        if (!g_events[i].fn) continue;
+        uint64_t in = (g_events[i].at > g_cycles) ? g_events[i].at - g_cycles : 0u;
+        if (in < best) best = in;
+    }
+    return best;
+}
+
+static void run_due_events(void)
+{
+    for (int i = 0; i < SIM_EVENTS; i++) {
+        if (g_events[i].fn && g_events[i].at <= g_cycles) {
+            void (*fn)(void) = g_events[i].fn;
+            g_events[i].fn = 0;
+            fn();
+        }
+    }
+}
+
+void sim_advance(uint32_t cycles)
+{
+    for (;;) {
+        run_due_events();
+        service();
+        if (!cycles) break;
+        if (g_st_val == 0) {
+            g_st_val = g_st_period - 1u;
+            g_pending |= 1u << SIM_IRQ_SYSTICK;
+            g_cycles++;
+            cycles--;
+            continue;
+        }
+        uint64_t step = (cycles < g_st_val) ? cycles : g_st_val;
+        uint64_t ev = next_event_in();
+        if (ev && ev < step) step = ev;
+        if (!step) step = 1u;
+        g_st_val -= (uint32_t)step;
+        g_cycles += step;
+        cycles -= (uint32_t)step;
+    }
+}
+
+uint64_t sim_cycles(void)
+{
+    return g_cycles;
+}
+
+bool sim_masked(void)
+{
+    return g_masked;
+}
+
+void sim_irq_register(sim_irq_t irq, void (*handler)(void))
+{
+    g_handlers[irq] = handler;
+}
+
+void sim_irq_raise(sim_irq_t irq)
+{
+    g_pending |= 1u << irq;
+}
+
+bool sim_at(uint64_t cycle, void (*fn)(void))
+{
+    for (int i = 0; i < SIM_EVENTS; i++) {
+        if (!g_events[i].fn) {
+            g_events[i].at = cycle;
+            g_events[i].fn = fn;
+            return true;
+        }
+    }
+    return false;
+}
+
+volatile uint32_t *sim_reg(uint32_t addr)
+{
+    if (addr == NVIC_INT_CTRL) {
+        g_int_ctrl = (g_pending & (1u << SIM_IRQ_SYSTICK)) ? NVIC_INT_CTRL_PEND_STSET : 0u;
+        return &g_int_ctrl;
+    }
+    return &g_scratch_reg;
+}
+
+void sim_reset(void)
+{
+    g_cycles = 0;
+    g_st_val = g_st_period - 1u;
+    g_pending = 0;
+    g_masked = false;
+    for (int i = 0; i < SIM_EVENTS; i++) g_events[i].fn = 0;
+}
+
+// ---------------------------------------------------------------------------
+// driverlib stand-ins
+// ---------------------------------------------------------------------------
+
+uint32_t SysCtlClockGet(void)
+{
+    return SIM_CPU_HZ;
+}
+
+void SysTickPeriodSet(uint32_t period)
+{
+    g_st_period = period ? period : 1u;
+    g_st_val = g_st_period - 1u;
+}
+
+uint32_t SysTickPeriodGet(void)
+{
+    return g_st_period;
+}
+
+uint32_t SysTickValueGet(void)
+{
+    return g_st_val;
+}
+
+void SysTickIntRegister(void (*handler)(void))
+{
+    sim_irq_register(SIM_IRQ_SYSTICK, handler);
+}
+
+void SysTickIntEnable(void)
+{
+}
+
+void SysTickEnable(void)
+{
+}
+
+bool IntMasterEnable(void)
+{
+    bool was = g_masked;
+    g_masked = false;
+    service();
+    return was;
+}
+
+bool IntMasterDisable(void)
+{
+    bool was = g_masked;
+    g_masked = true;
+    return was;
+}
+
+void IntEnable(uint32_t interrupt)
+{
+    (void)interrupt;
+}
+
+void IntDisable(uint32_t interrupt)
+{
+    (void)interrupt;
+}
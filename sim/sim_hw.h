@@ -0,0 +1,44 @@
+#ifndef USER_SIM_HW_H
+#define USER_SIM_HW_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Simulated Cortex-M4 core for host builds of the firmware timing code.
+// Time only moves when the simulation calls sim_advance(). SysTick counts
+// down from period-1 and pends its interrupt on reload. Pending interrupts
+// run their handler as soon as interrupts are unmasked, lowest line first,
+// once per pending period (repeated requests collapse, like on hardware).
+// Handlers share one priority, so they never nest.
+
+#define SIM_CPU_HZ 50000000u
+
+typedef enum {
+    SIM_IRQ_SYSTICK = 0,
+    SIM_IRQ_UART1,
+    SIM_IRQ_COUNT
+} sim_irq_t;
+
+// Advance the core clock. Pending interrupts are serviced unless masked.
+void sim_advance(uint32_t cycles);
+
+// Core cycles since sim_reset()
+uint64_t sim_cycles(void);
+
+// True while IntMasterDisable() is in effect or a handler is running
+bool sim_masked(void);
+
+void sim_irq_register(sim_irq_t irq, void (*handler)(void));
+void sim_irq_raise(sim_irq_t irq);
+
+// Call fn when the clock reaches 'cycle' (from inside sim_advance(), in
+// interrupt-like context). Returns false if all event slots are in use.
+bool sim_at(uint64_t cycle, void (*fn)(void));
+
+// Backing store for HWREG() on the host (see stubs/inc/hw_types.h)
+volatile uint32_t *sim_reg(uint32_t addr);
+
+// Reset the clock, SysTick, events and mask state (handlers stay)
+void sim_reset(void);
+
+#endif // USER_SIM_HW_H
@@ -0,0 +1,264 @@
+#include "sim_uart.h"
+
+#include "sim_hw.h"
+
+#include "driverlib/gpio.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+#include "inc/hw_uart.h"
+
+#define FIFO_DEPTH   16u
+#define RX_IRQ_LEVEL 8u        // UART_FIFO_RX4_8
+#define TX_IRQ_LEVEL 8u        // UART_FIFO_TX4_8
+#define REG_CYCLES   12u       // one peripheral register access
+#define PEER_BUF     8192u
+
+static uint32_t g_baud = 115200u;
+static uint32_t g_int_mask;
+
+// Peer -> firmware
+static uint8_t g_peer[PEER_BUF];
+static uint32_t g_peer_head, g_peer_tail;
+static bool g_arrival_armed;
+static uint8_t g_rx_fifo[FIFO_DEPTH];
+static uint32_t g_rx_head, g_rx_tail;
+static bool g_rx_overrun;
+static uint64_t g_rx_timeout_at;
+
+// Firmware -> peer
+static uint64_t g_tx_done_at;          // when the last queued frame finishes
+static uint32_t g_tx_count;
+static bool g_tx_ris;                  // FIFO drained through TX_IRQ_LEVEL
+static bool g_tx_event_armed;
+
+static void on_rx_timeout(void);
+
+uint32_t sim_uart_frame_cycles(void)
+{
+    return (uint32_t)((uint64_t)SIM_CPU_HZ * 10u / g_baud);
+}
+
+static uint32_t rx_level(void)
+{
+    return g_rx_head - g_rx_tail;
+}
+
+static void on_rx_arrival(void)
+{
+    g_arrival_armed = false;
+    if (g_peer_tail == g_peer_head) return;
+    uint8_t b = g_peer[g_peer_tail++ % PEER_BUF];
+    if (rx_level() < FIFO_DEPTH) {
+        g_rx_fifo[g_rx_head++ % FIFO_DEPTH] = b;
+    } else {
+        g_rx_overrun = true;
+    }
+    if (rx_level() >= RX_IRQ_LEVEL && (g_int_mask & UART_INT_RX)) sim_irq_raise(SIM_IRQ_UART1);
+
+    if (g_peer_tail != g_peer_head) {
+        g_arrival_armed = sim_at(sim_cycles() + sim_uart_frame_cycles(), on_rx_arrival);
+    } else {
+        g_rx_timeout_at = sim_cycles() + sim_uart_frame_cycles() * 32u / 10u;
+        sim_at(g_rx_timeout_at, on_rx_timeout);
+    }
+}
+
+static void on_rx_timeout(void)
+{
+    // Only the timeout armed after the latest byte counts
+    if (sim_cycles() < g_rx_timeout_at || g_peer_tail != g_peer_head) return;
+    if (rx_level() && (g_int_mask & UART_INT_RT)) sim_irq_raise(SIM_IRQ_UART1);
+}
+
+void sim_uart_send(const char *s, size_t n)
+{
+    for (size_t i = 0; i < n && g_peer_head - g_peer_tail < PEER_BUF; i++) {
+        g_peer[g_peer_head++ % PEER_BUF] = (uint8_t)s[i];
+    }
+    if (!g_arrival_armed && g_peer_tail != g_peer_head) {
+        g_arrival_armed = sim_at(sim_cycles() + sim_uart_frame_cycles(), on_rx_arrival);
+    }
+}
+
+uint32_t sim_uart_tx_count(void)
+{
+    return g_tx_count;
+}
+
+static uint32_t tx_level(void)
+{
+    uint64_t now = sim_cycles();
+    if (g_tx_done_at <= now) return 0;
+    uint32_t frame = sim_uart_frame_cycles();
+    return (uint32_t)((g_tx_done_at - now + frame - 1u) / frame);
+}
+
+// When the FIFO will have drained to TX_IRQ_LEVEL
+static uint64_t tx_trigger_at(void)
+{
+    return g_tx_done_at - (uint64_t)TX_IRQ_LEVEL * sim_uart_frame_cycles();
+}
+
+static void on_tx_trigger(void)
+{
+    g_tx_event_armed = false;
+    if (tx_level() > TX_IRQ_LEVEL) {
+        g_tx_event_armed = sim_at(tx_trigger_at(), on_tx_trigger);
+        return;
+    }
+    g_tx_ris = true;
+    if (g_int_mask & UART_INT_TX) sim_irq_raise(SIM_IRQ_UART1);
+}
+
+static void tx_push(void)
+{
+    uint64_t now = sim_cycles();
+    if (g_tx_done_at < now) g_tx_done_at = now;
+    g_tx_done_at += sim_uart_frame_cycles();
+    g_tx_count++;
+    if (tx_level() > TX_IRQ_LEVEL && !g_tx_event_armed) {
+        g_tx_event_armed = sim_at(tx_trigger_at(), on_tx_trigger);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// driverlib stand-ins
+// ---------------------------------------------------------------------------
+
+void SysCtlPeripheralEnable(uint32_t peripheral)
+{
+    (void)peripheral;
+}
+
+bool SysCtlPeripheralReady(uint32_t peripheral)
+{
+    (void)peripheral;
+    return true;
+}
+
+void GPIOPinConfigure(uint32_t config)
+{
+    (void)config;
+}
+
+void GPIOPinTypeUART(uint32_t port, uint8_t pins)
+{
+    (void)port; (void)pins;
+}
+
+void UARTClockSourceSet(uint32_t base, uint32_t source)
+{
+    (void)base; (void)source;
+}
+
+void UARTConfigSetExpClk(uint32_t base, uint32_t clk, uint32_t baud, uint32_t config)
+{
+    (void)base; (void)clk; (void)config;
+    if (baud) g_baud = baud;
+}
+
+void UARTEnable(uint32_t base)
+{
+    (void)base;
+}
+
+void UARTDisable(uint32_t base)
+{
+    (void)base;
+}
+
+void UARTFIFOLevelSet(uint32_t base, uint32_t tx_level, uint32_t rx_level)
+{
+    (void)base; (void)tx_level; (void)rx_level;
+}
+
+void UARTFIFOEnable(uint32_t base)
+{
+    (void)base;
+}
+
+void UARTIntRegister(uint32_t base, void (*handler)(void))
+{
+    (void)base;
+    sim_irq_register(SIM_IRQ_UART1, handler);
+}
+
+void UARTIntEnable(uint32_t base, uint32_t flags)
+{
+    (void)base;
+    g_int_mask |= flags;
+    if ((flags & UART_INT_TX) && g_tx_ris) sim_irq_raise(SIM_IRQ_UART1);
+}
+
+void UARTIntDisable(uint32_t base, uint32_t flags)
+{
+    (void)base;
+    g_int_mask &= ~flags;
+}
+
+uint32_t UARTIntStatus(uint32_t base, bool masked)
+{
+    (void)base;
+    sim_advance(REG_CYCLES);
+    uint32_t raw = 0;
+    if (rx_level() >= RX_IRQ_LEVEL) raw |= UART_INT_RX;
+    if (rx_level()) raw |= UART_INT_RT;
+    if (g_tx_ris) raw |= UART_INT_TX;
+    return masked ? (raw & g_int_mask) : raw;
+}
+
+void UARTIntClear(uint32_t base, uint32_t flags)
+{
+    (void)base;
+    sim_advance(REG_CYCLES);
+    if (flags & UART_INT_TX) g_tx_ris = false;
+}
+
+bool UARTCharsAvail(uint32_t base)
+{
+    (void)base;
+    sim_advance(REG_CYCLES);
+    return rx_level() != 0;
+}
+
+int32_t UARTCharGetNonBlocking(uint32_t base)
+{
+    (void)base;
+    sim_advance(REG_CYCLES);
+    if (!rx_level()) return -1;
+    int32_t ch = g_rx_fifo[g_rx_tail++ % FIFO_DEPTH];
+    if (g_rx_overrun) {
+        g_rx_overrun = false;
+        ch |= UART_DR_OE;
+    }
+    return ch;
+}
+
+bool UARTSpaceAvail(uint32_t base)
+{
+    (void)base;
+    sim_advance(REG_CYCLES);
+    return tx_level() < FIFO_DEPTH;
+}
+
+void UARTCharPut(uint32_t base, unsigned char c)
+{
+    (void)c;
+    while (!UARTSpaceAvail(base)) {}
+    tx_push();
+}
+
+bool UARTCharPutNonBlocking(uint32_t base, unsigned char c)
+{
+    (void)c;
+    if (!UARTSpaceAvail(base)) return false;
+    tx_push();
+    return true;
+}
+
+bool UARTBusy(uint32_t base)
+{
+    (void)base;
+    sim_advance(REG_CYCLES);
+    return tx_level() != 0;
+}
@@ -0,0 +1,24 @@
+#ifndef USER_SIM_UART_H
+#define USER_SIM_UART_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Simulated UART1 (the ESP32 link) on top of sim_hw. Bytes from the peer
+// arrive one frame time apart into a 16-byte RX FIFO; the RX interrupt
+// fires at half full and the receive-timeout interrupt 32 bit times after
+// the last byte. TX bytes leave at line rate from a 16-byte FIFO, and
+// UARTCharPut() waits (with interrupts serviced) while it is full; the TX
+// interrupt fires when the FIFO drains through half full.
+// Each register access costs a few core cycles.
+
+// Queue bytes from the peer behind anything still in flight
+void sim_uart_send(const char *s, size_t n);
+
+// Frames sent by the firmware so far
+uint32_t sim_uart_tx_count(void);
+
+// Core cycles per 10-bit frame at the current baud rate
+uint32_t sim_uart_frame_cycles(void);
+
+#endif // USER_SIM_UART_H
@@ -0,0 +1,14 @@
+#ifndef USER_SIM_DRIVERLIB_GPIO_H
+#define USER_SIM_DRIVERLIB_GPIO_H
+
+// Host stand-in for TivaWare driverlib/gpio.h (see sim/sim_uart.c)
+
+#include <stdint.h>
+
+#define GPIO_PIN_4 0x10
+#define GPIO_PIN_5 0x20
+
+void GPIOPinConfigure(uint32_t config);
+void GPIOPinTypeUART(uint32_t port, uint8_t pins);
+
+#endif // USER_SIM_DRIVERLIB_GPIO_H
@@ -0,0 +1,16 @@
+#ifndef USER_SIM_DRIVERLIB_INTERRUPT_H
+#define USER_SIM_DRIVERLIB_INTERRUPT_H
+
+// Host stand-in for TivaWare driverlib/interrupt.h (see sim/sim_hw.c)
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Both return the previous mask state, like the TivaWare versions
+bool IntMasterEnable(void);
+bool IntMasterDisable(void);
+
+void IntEnable(uint32_t interrupt);
+void IntDisable(uint32_t interrupt);
+
+#endif // USER_SIM_DRIVERLIB_INTERRUPT_H
@@ -0,0 +1,9 @@
+#ifndef USER_SIM_DRIVERLIB_PIN_MAP_H
+#define USER_SIM_DRIVERLIB_PIN_MAP_H
+
+// Host stand-in for TivaWare driverlib/pin_map.h (see sim/sim_uart.c)
+
+#define GPIO_PC4_U1RX 0x00021001
+#define GPIO_PC5_U1TX 0x00021401
+
+#endif // USER_SIM_DRIVERLIB_PIN_MAP_H
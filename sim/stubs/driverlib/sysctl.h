@@ -0,0 +1,16 @@
+#ifndef USER_SIM_DRIVERLIB_SYSCTL_H
+#define USER_SIM_DRIVERLIB_SYSCTL_H
+
+// Host stand-in for TivaWare driverlib/sysctl.h (see sim/sim_hw.c, sim/sim_uart.c)
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SYSCTL_PERIPH_GPIOC 0xf0000802
+#define SYSCTL_PERIPH_UART1 0xf0001801
+
+uint32_t SysCtlClockGet(void);
+void SysCtlPeripheralEnable(uint32_t peripheral);
+bool SysCtlPeripheralReady(uint32_t peripheral);
+
+#endif // USER_SIM_DRIVERLIB_SYSCTL_H
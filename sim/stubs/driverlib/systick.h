@@ -0,0 +1,15 @@
+#ifndef USER_SIM_DRIVERLIB_SYSTICK_H
+#define USER_SIM_DRIVERLIB_SYSTICK_H
+
+// Host stand-in for TivaWare driverlib/systick.h (see sim/sim_hw.c)
+
+#include <stdint.h>
+
+void SysTickPeriodSet(uint32_t period);
+uint32_t SysTickPeriodGet(void);
+uint32_t SysTickValueGet(void);
+void SysTickIntRegister(void (*handler)(void));
+void SysTickIntEnable(void);
+void SysTickEnable(void);
+
+#endif // USER_SIM_DRIVERLIB_SYSTICK_H
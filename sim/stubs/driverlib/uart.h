@@ -0,0 +1,37 @@
+#ifndef USER_SIM_DRIVERLIB_UART_H
+#define USER_SIM_DRIVERLIB_UART_H
+
+// Host stand-in for TivaWare driverlib/uart.h (see sim/sim_uart.c)
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define UART_CLOCK_PIOSC     0x00000005
+#define UART_CONFIG_WLEN_8   0x00000060
+#define UART_CONFIG_STOP_ONE 0x00000000
+#define UART_CONFIG_PAR_NONE 0x00000000
+#define UART_FIFO_TX4_8      0x00000002
+#define UART_FIFO_RX4_8      0x00000010
+#define UART_INT_RX          0x010
+#define UART_INT_TX          0x020
+#define UART_INT_RT          0x040
+
+void UARTClockSourceSet(uint32_t base, uint32_t source);
+void UARTConfigSetExpClk(uint32_t base, uint32_t clk, uint32_t baud, uint32_t config);
+void UARTEnable(uint32_t base);
+void UARTDisable(uint32_t base);
+void UARTFIFOLevelSet(uint32_t base, uint32_t tx_level, uint32_t rx_level);
+void UARTFIFOEnable(uint32_t base);
+void UARTIntRegister(uint32_t base, void (*handler)(void));
+void UARTIntEnable(uint32_t base, uint32_t flags);
+void UARTIntDisable(uint32_t base, uint32_t flags);
+uint32_t UARTIntStatus(uint32_t base, bool masked);
+void UARTIntClear(uint32_t base, uint32_t flags);
+bool UARTCharsAvail(uint32_t base);
+bool UARTSpaceAvail(uint32_t base);
+int32_t UARTCharGetNonBlocking(uint32_t base);
+void UARTCharPut(uint32_t base, unsigned char c);
+bool UARTCharPutNonBlocking(uint32_t base, unsigned char c);
+bool UARTBusy(uint32_t base);
+
+#endif // USER_SIM_DRIVERLIB_UART_H
@@ -0,0 +1,8 @@
+#ifndef USER_SIM_INC_HW_INTS_H
+#define USER_SIM_INC_HW_INTS_H
+
+// Host stand-in for TivaWare inc/hw_ints.h (see sim/sim_uart.c)
+
+#define INT_UART1 22
+
+#endif // USER_SIM_INC_HW_INTS_H
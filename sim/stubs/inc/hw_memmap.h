@@ -0,0 +1,9 @@
+#ifndef USER_SIM_INC_HW_MEMMAP_H
+#define USER_SIM_INC_HW_MEMMAP_H
+
+// Host stand-in for TivaWare inc/hw_memmap.h (see sim/sim_uart.c)
+
+#define GPIO_PORTC_BASE 0x40006000
+#define UART1_BASE      0x4000D000
+
+#endif // USER_SIM_INC_HW_MEMMAP_H
@@ -0,0 +1,9 @@
+#ifndef USER_SIM_INC_HW_NVIC_H
+#define USER_SIM_INC_HW_NVIC_H
+
+// Host stand-in for TivaWare inc/hw_nvic.h (see sim/sim_hw.c)
+
+#define NVIC_INT_CTRL            0xE000ED04
+#define NVIC_INT_CTRL_PEND_STSET 0x04000000
+
+#endif // USER_SIM_INC_HW_NVIC_H
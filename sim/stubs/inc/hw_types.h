@@ -0,0 +1,12 @@
+#ifndef USER_SIM_INC_HW_TYPES_H
+#define USER_SIM_INC_HW_TYPES_H
+
+// Host stand-in for TivaWare inc/hw_types.h (see sim/sim_hw.c)
+
+#include <stdint.h>
+#include "sim_hw.h"
+
+// Register accesses go to the simulated core instead of raw addresses
+#define HWREG(x) (*sim_reg((uint32_t)(x)))
+
+#endif // USER_SIM_INC_HW_TYPES_H
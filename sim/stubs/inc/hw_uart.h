@@ -0,0 +1,11 @@
+#ifndef USER_SIM_INC_HW_UART_H
+#define USER_SIM_INC_HW_UART_H
+
+// Host stand-in for TivaWare inc/hw_uart.h (see sim/sim_uart.c)
+
+#define UART_DR_OE 0x00000800
+#define UART_DR_BE 0x00000400
+#define UART_DR_PE 0x00000200
+#define UART_DR_FE 0x00000100
+
+#endif // USER_SIM_INC_HW_UART_H
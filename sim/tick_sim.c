@@ -0,0 +1,123 @@
+// Host check of tick.c and deadline_t across 32-bit millisecond wraps.
+//
+// tick.c is compiled into this file so the 64-bit counter can be
+// fast-forwarded to just before each 2^32 ms boundary. From there the
+// simulated SysTick is clocked through the boundary in sub-millisecond
+// steps and every reading is compared with the cycle-exact expectation,
+// including readings taken with interrupts masked across a reload.
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sim_hw.h"
+#include "driverlib/interrupt.h"
+#include "../tick.c"
+
+#define STEP_CYCLES 7919u     // prime, < 1 ms, so every ms is observed
+#define LEAD_MS     3000u     // start this far before the boundary
+#define RUN_MS      6000u
+
+static unsigned g_checks;
+
+#define CHECK(cond) do { \
+        g_checks++; \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+typedef struct {
+    deadline_t d;
+    uint64_t fired_ms;        // tick_ms() when first seen expired, 0 = not yet
+} probe_t;
+
+static void probe_check(probe_t *p, uint64_t now)
+{
+    bool expired = deadline_expired(p->d);
+    CHECK(expired == (now >= p->d.at_ms));
+    CHECK(deadline_remaining_ms(p->d) == (expired ? 0u : p->d.at_ms - now));
+    if (expired && !p->fired_ms) p->fired_ms = now;
+}
+
+static void cross_boundary(uint64_t boundary)
+{
+    uint64_t base = boundary - LEAD_MS;
+    uint32_t period = SysTickPeriodGet();
+
+    sim_reset();
+    g_ms = base;
+
+    probe_t probes[] = {
+        { deadline_in_ms(1000u), 0 },             // due before the wrap
+        { deadline_at_ms(boundary), 0 },          // due exactly at it
+        { deadline_in_ms(LEAD_MS + 1500u), 0 },   // due after it
+        { deadline_in_ms(0xFFFFFFFFu), 0 },       // longest 32-bit delay
+    };
+    const size_t nprobes = sizeof(probes) / sizeof(probes[0]);
+    CHECK(probes[3].d.at_ms == base + 0xFFFFFFFFull);
+
+    uint64_t last_us = tick_us();
+    uint32_t last_millis = millis();
+    unsigned millis_wraps = 0;
+
+    unsigned masked_reloads = 0;
+
+    for (unsigned step = 0; tick_ms() < base + RUN_MS; step++) {
+        // Every third step runs with interrupts masked, as in task_post()
+        // or an ISR, so SysTick reloads with its ISR still pending
+        if (step % 3u == 0u) {
+            uint64_t ms_before = g_ms;
+            IntMasterDisable();
+            sim_advance(STEP_CYCLES);
+            uint64_t us = tick_us();
+            if (g_ms == ms_before && us / 1000u != ms_before) masked_reloads++;
+            CHECK(us == base * 1000u + sim_cycles() * 1000u / period);
+            CHECK(us >= last_us);
+            last_us = us;
+            IntMasterEnable();
+        } else {
+            sim_advance(STEP_CYCLES);
+        }
+
+        uint64_t ms = tick_ms();
+        uint64_t us = tick_us();
+        CHECK(us == base * 1000u + sim_cycles() * 1000u / period);
+        CHECK(ms == us / 1000u);
+        CHECK(us >= last_us);
+        CHECK(millis() == (uint32_t)ms);
+        if (millis() < last_millis) millis_wraps++;
+
+        for (size_t i = 0; i < nprobes; i++) probe_check(&probes[i], ms);
+        last_us = us;
+        last_millis = millis();
+    }
+
+    CHECK(millis_wraps == 1u);
+    CHECK(masked_reloads > 0u);
+    for (size_t i = 0; i < 3; i++) CHECK(probes[i].fired_ms == probes[i].d.at_ms);
+    CHECK(probes[3].fired_ms == 0);
+
+    printf("boundary %#018" PRIx64 ": tick_ms %" PRIu64 " -> %" PRIu64
+           ", millis wrapped once, deadlines fired on time, "
+           "%u reloads read with the ISR pending\n",
+           boundary, base, tick_ms(), masked_reloads);
+}
+
+int main(void)
+{
+    tick_init();
+    SysTickIntRegister(tick_isr);
+
+    static const uint64_t boundaries[] = {
+        1ull << 32, 2ull << 32, 3ull << 32, 4ull << 32,
+        0xFFFFFull << 32,     // ~142 million years of uptime
+    };
+    for (size_t i = 0; i < sizeof(boundaries) / sizeof(boundaries[0]); i++) {
+        cross_boundary(boundaries[i]);
+    }
+
+    printf("tick_sim: ok (%u checks)\n", g_checks);
+    return 0;
+}
@@ -0,0 +1,18 @@
+#include "spsc_ring.h"
+
+bool spsc_ring_init(spsc_ring_t *r, uint8_t *buf, uint32_t size)
+{
+    if (!r || !buf || size == 0 || (size & (size - 1u)) != 0) return false;
+    r->buf = buf;
+    r->mask = size - 1u;
+    r->head = 0;
+    r->tail = 0;
+    spsc_ring_reset_stats(r);
+    return true;
+}
+
+void spsc_ring_reset_stats(spsc_ring_t *r)
+{
+    r->overflows = 0;
+    r->high_water = 0;
+}
@@ -0,0 +1,92 @@
+#ifndef USER_SPSC_RING_H
+#define USER_SPSC_RING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Lock-free single-producer / single-consumer byte ring.
+// The size must be a power of two. Head and tail run freely and are
+// masked on access, so all size bytes are usable and used = head - tail.
+// The producer (typically an ISR) only writes head, and the consumer only
+// writes tail. A DMB orders the data access against publishing the index.
+//
+// Consumers can drain in bulk: read_span() returns the contiguous readable
+// bytes in place, and consume() releases them once they have been handled.
+
+#if defined(__arm__)
+#define SPSC_DMB() __asm volatile ("dmb" ::: "memory")
+#else
+#define SPSC_DMB() __sync_synchronize()
+#endif
+
+typedef struct {
+    uint8_t *buf;
+    uint32_t mask;               // size - 1
+    volatile uint32_t head;      // producer only
+    volatile uint32_t tail;      // consumer only
+    volatile uint32_t overflows; // bytes dropped because the ring was full
+    volatile uint32_t high_water;
+} spsc_ring_t;
+
+// Returns false if size is not a non-zero power of two
+bool spsc_ring_init(spsc_ring_t *r, uint8_t *buf, uint32_t size);
+
+// Clear the overflow and high-water counters (not the contents)
+void spsc_ring_reset_stats(spsc_ring_t *r);
+
+static inline uint32_t spsc_ring_size(const spsc_ring_t *r)
+{
+    return r->mask + 1u;
+}
+
+static inline uint32_t spsc_ring_used(const spsc_ring_t *r)
+{
+    return r->head - r->tail;
+}
+
+// Producer side. Drops the byte and counts an overflow when full.
+static inline bool spsc_ring_push(spsc_ring_t *r, uint8_t b)
+{
+    uint32_t head = r->head;
+    uint32_t used = head - r->tail;
+    if (used > r->mask) {
+        r->overflows++;
+        return false;
+    }
+    r->buf[head & r->mask] = b;
+    SPSC_DMB();                  // data visible before the new head
+    r->head = head + 1u;
+    if (used + 1u > r->high_water) r->high_water = used + 1u;
+    return true;
+}
+
+// Consumer side. Points *p at the oldest unread byte and returns how many
+// bytes can be read contiguously from there (0 if empty).
+static inline uint32_t spsc_ring_read_span(const spsc_ring_t *r, const uint8_t **p)
+{
+    uint32_t tail = r->tail;
+    uint32_t used = r->head - tail;
+    SPSC_DMB();                  // head read before the data it covers
+    uint32_t idx = tail & r->mask;
+    uint32_t to_end = r->mask + 1u - idx;
+    *p = &r->buf[idx];
+    return (used < to_end) ? used : to_end;
+}
+
+// Consumer side. Release n bytes previously returned by read_span().
+static inline void spsc_ring_consume(spsc_ring_t *r, uint32_t n)
+{
+    SPSC_DMB();                  // finish reading before the slots are reused
+    r->tail += n;
+}
+
+static inline bool spsc_ring_pop(spsc_ring_t *r, uint8_t *b)
+{
+    const uint8_t *p;
+    if (spsc_ring_read_span(r, &p) == 0) return false;
+    *b = *p;
+    spsc_ring_consume(r, 1u);
+    return true;
+}
+
+#endif // USER_SPSC_RING_H
@@ -6,26 +6,19 @@
 #include "inc/hw_memmap.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/gpio.h"
-
-extern uint32_t SystemCoreClock;
+#include "tick.h"
 
 static stepper_uln2003_cfg_t s_cfg;
 static uint8_t s_step_idx = 0; // 0..7 for half-step sequence
 static uint32_t s_led_base = 0; static uint8_t s_led_pin = 0; static int s_led_en = 0;
 
-static void delay_us(uint32_t us)
+// SysTick-based wait (a nop loop drifts badly over whole milliseconds)
+static void delay_ms(uint32_t ms)
 {
-    // Fixed precision: use integer arithmetic with rounding (same as hx711_tiva.c)
-    uint32_t clk = (SystemCoreClock ? SystemCoreClock : 16000000u);
-    uint32_t cycles_per_us = (clk + 2000000u) / 4000000u; // Add half divisor for rounding
-    if (cycles_per_us == 0) cycles_per_us = 1;
-    volatile uint32_t total = us * cycles_per_us;
-    while (total--) { __asm volatile ("nop"); }
+    deadline_t done = deadline_in_ms(ms);
+    while (!deadline_expired(done)) {}
 }
 
-static void delay_ms(uint32_t ms)
-{ while (ms--) delay_us(1000u); }
-
 // Enable GPIO port clock using TivaWare API
 static void enable_gpio_port(uint32_t base)
 {
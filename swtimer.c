@@ -0,0 +1,144 @@
+#include "swtimer.h"
+
+#include <stddef.h>
+
+#include "tick.h"
+
+#define LVL0_BITS  8u
+#define LVLN_BITS  6u
+#define LVL0_SIZE  (1u << LVL0_BITS)
+#define LVLN_SIZE  (1u << LVLN_BITS)
+#define LVL0_MASK  (LVL0_SIZE - 1u)
+#define LVLN_MASK  (LVLN_SIZE - 1u)
+#define LVLN_COUNT 3u
+
+// Shift of level n (1..3): 8, 14, 20
+#define LVL_SHIFT(n) (LVL0_BITS + ((n) - 1u) * LVLN_BITS)
+// Longest delta that fits in the wheel (level 3 span)
+#define WHEEL_SPAN  (1ull << (LVL0_BITS + LVLN_COUNT * LVLN_BITS))
+
+static swtimer_t *g_lvl0[LVL0_SIZE];
+static swtimer_t *g_lvln[LVLN_COUNT][LVLN_SIZE];
+static uint64_t g_clk;                 // last processed tick
+static void (*g_kick)(void);
+
+static void list_add(swtimer_t **head, swtimer_t *t)
+{
+    t->next = *head;
+    if (t->next) t->next->pprev = &t->next;
+    *head = t;
+    t->pprev = head;
+}
+
+static void list_del(swtimer_t *t)
+{
+    *t->pprev = t->next;
+    if (t->next) t->next->pprev = t->pprev;
+    t->next = NULL;
+    t->pprev = NULL;
+}
+
+// Place 't' relative to g_clk. Timers due before 'base' go into base's slot.
+static void wheel_add(swtimer_t *t, uint64_t base)
+{
+    uint64_t expires = (t->expires_ms < base) ? base : t->expires_ms;
+    uint64_t delta = expires - g_clk;
+
+    if (delta < LVL0_SIZE) {
+        list_add(&g_lvl0[expires & LVL0_MASK], t);
+        return;
+    }
+    if (delta >= WHEEL_SPAN) expires = g_clk + WHEEL_SPAN - 1u;  // re-placed on cascade
+    for (uint32_t n = 1; n <= LVLN_COUNT; n++) {
+        if (delta < (1ull << LVL_SHIFT(n + 1u)) || n == LVLN_COUNT) {
+            list_add(&g_lvln[n - 1u][(expires >> LVL_SHIFT(n)) & LVLN_MASK], t);
+            return;
+        }
+    }
+}
+
+static void cascade(uint32_t n)
+{
+    swtimer_t **slot = &g_lvln[n - 1u][(g_clk >> LVL_SHIFT(n)) & LVLN_MASK];
+    swtimer_t *t = *slot;
+    *slot = NULL;
+    while (t) {
+        swtimer_t *next = t->next;
+        t->next = NULL;
+        t->pprev = NULL;
+        wheel_add(t, g_clk);
+        t = next;
+    }
+}
+
+void swtimer_service_init(void (*kick)(void))
+{
+    g_clk = tick_ms();
+    g_kick = kick;
+}
+
+void swtimer_init(swtimer_t *t, swtimer_cb_t cb, void *arg)
+{
+    t->next = NULL;
+    t->pprev = NULL;
+    t->expires_ms = 0;
+    t->period_ms = 0;
+    t->cb = cb;
+    t->arg = arg;
+}
+
+void swtimer_arm(swtimer_t *t, uint32_t delay_ms, uint32_t period_ms)
+{
+    if (t->pprev) list_del(t);
+    uint64_t now = tick_ms();
+    t->expires_ms = now + delay_ms;
+    t->period_ms = period_ms;
+    wheel_add(t, g_clk + 1u);
+    if (t->expires_ms <= now && g_kick) g_kick();
+}
+
+void swtimer_cancel(swtimer_t *t)
+{
+    if (t->pprev) list_del(t);
+}
+
+bool swtimer_tick_isr(void)
+{
+    uint64_t now = tick_ms();
+    // Reading a slot head here races benignly with task-context updates:
+    // a timer armed for 'now' after this check was due already and kicked.
+    return ((now & LVL0_MASK) == 0u) || (g_lvl0[now & LVL0_MASK] != NULL);
+}
+
+void swtimer_run(void)
+{
+    uint64_t now = tick_ms();
+    while (g_clk < now) {
+        g_clk++;
+        if ((g_clk & LVL0_MASK) == 0u) {
+            // Higher levels first so their timers can land in lower slots
+            // that are cascaded in this same tick
+            uint32_t n = 1;
+            while (n < LVLN_COUNT && ((g_clk >> LVL_SHIFT(n)) & LVLN_MASK) == 0u) n++;
+            for (; n >= 1u; n--) cascade(n);
+        }
+
+        // Move the due slot to a local list; callbacks may arm/cancel freely
+        swtimer_t *due = NULL;
+        swtimer_t **slot = &g_lvl0[g_clk & LVL0_MASK];
+        if (*slot) {
+            due = *slot;
+            due->pprev = &due;
+            *slot = NULL;
+        }
+        while (due) {
+            swtimer_t *t = due;
+            list_del(t);
+            if (t->period_ms) {
+                t->expires_ms += t->period_ms;
+                wheel_add(t, g_clk + 1u);
+            }
+            t->cb(t, t->arg);
+        }
+    }
+}
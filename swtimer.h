@@ -0,0 +1,58 @@
+#ifndef USER_SWTIMER_H
+#define USER_SWTIMER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Hierarchical software timer wheel (1 ms resolution).
+// Level 0 has 256 x 1 ms slots; levels 1..3 have 64 slots each covering
+// 256 ms, 16.4 s and 17.5 min. Arm and cancel are O(1) list operations.
+// Timers in upper levels are cascaded down when their slot comes due.
+//
+// SysTick calls swtimer_tick_isr(), which only asks for service when the
+// current level-0 slot is non-empty or a cascade is due. Callbacks run from
+// swtimer_run() in task context, never from the ISR.
+
+typedef struct swtimer swtimer_t;
+typedef void (*swtimer_cb_t)(swtimer_t *t, void *arg);
+
+struct swtimer {
+    swtimer_t *next;
+    swtimer_t **pprev;      // NULL when not armed
+    uint64_t expires_ms;    // tick_ms() time
+    uint32_t period_ms;     // 0 = one-shot
+    swtimer_cb_t cb;
+    void *arg;
+};
+
+// 'kick' is called (from task context) when a timer is armed that is
+// already due, so the owner can schedule swtimer_run() without waiting
+// for the next SysTick.
+void swtimer_service_init(void (*kick)(void));
+
+void swtimer_init(swtimer_t *t, swtimer_cb_t cb, void *arg);
+
+// Fire after delay_ms, then every period_ms if non-zero. Re-arming an
+// armed timer moves it.
+void swtimer_arm(swtimer_t *t, uint32_t delay_ms, uint32_t period_ms);
+void swtimer_cancel(swtimer_t *t);
+
+static inline bool swtimer_armed(const swtimer_t *t)
+{
+    return t->pprev != 0;
+}
+
+// Expiry time being serviced; valid inside the timer's own callback
+// (periodic timers are already advanced to their next expiry by then).
+static inline uint64_t swtimer_due_ms(const swtimer_t *t)
+{
+    return t->period_ms ? (t->expires_ms - t->period_ms) : t->expires_ms;
+}
+
+// Called every ms from SysTick. Returns true if swtimer_run() has work.
+bool swtimer_tick_isr(void);
+
+// Process all ticks up to tick_ms() and run expired callbacks.
+void swtimer_run(void);
+
+#endif // USER_SWTIMER_H
@@ -0,0 +1,116 @@
+#include "task.h"
+
+#include <string.h>
+
+#include "driverlib/interrupt.h"
+#include "tick.h"
+#include "jitter.h"
+
+typedef struct {
+    task_fn_t fn;
+    uint32_t period_ms;
+    uint32_t deadline_ms;
+    volatile uint32_t countdown;    // ms until next release (ISR only)
+    volatile uint64_t release_us;   // tick_us() of the pending release
+    task_stats_t st;
+} task_t;
+
+static task_t g_tasks[TASK_MAX];
+static uint32_t g_created = 0;         // bit per registered task
+static volatile uint32_t g_ready = 0;  // bit per ready task; bit 0 = most urgent
+
+// Release 'id' at 'now'. Caller guarantees no concurrent writer (ISR, or
+// interrupts masked).
+static inline void release(int id, uint64_t now)
+{
+    uint32_t bit = 1u << id;
+    if (g_ready & bit) {
+        g_tasks[id].st.missed++;
+    } else {
+        g_tasks[id].release_us = now;
+        g_ready |= bit;
+    }
+}
+
+int task_create(const char *name, task_fn_t fn, uint8_t prio,
+                uint32_t period_ms, uint32_t deadline_ms)
+{
+    if (prio >= TASK_MAX || !fn || (g_created & (1u << prio))) return -1;
+
+    task_t *t = &g_tasks[prio];
+    memset(t, 0, sizeof(*t));
+    t->fn = fn;
+    t->period_ms = period_ms;
+    t->deadline_ms = deadline_ms ? deadline_ms : period_ms;
+    t->countdown = period_ms;
+    t->st.name = name;
+    g_created |= 1u << prio;
+    return prio;
+}
+
+void task_tick_isr(void)
+{
+    uint32_t pending = g_created;
+    uint64_t now = 0;
+    while (pending) {
+        int id = __builtin_ctz(pending);
+        pending &= pending - 1u;
+        task_t *t = &g_tasks[id];
+        if (t->period_ms == 0) continue;
+        if (--t->countdown == 0) {
+            t->countdown = t->period_ms;
+            if (now == 0) now = tick_us();
+            release(id, now);
+        }
+    }
+}
+
+void task_post(int id)
+{
+    if (id < 0 || id >= TASK_MAX || !(g_created & (1u << id))) return;
+    bool was_masked = IntMasterDisable();
+    release(id, tick_us());
+    if (!was_masked) IntMasterEnable();
+}
+
+bool task_run_next(void)
+{
+    uint32_t ready = g_ready;
+    if (!ready) return false;
+
+    int id = __builtin_ctz(ready);
+    task_t *t = &g_tasks[id];
+
+    bool was_masked = IntMasterDisable();
+    g_ready &= ~(1u << id);
+    uint64_t release_us = t->release_us;
+    if (!was_masked) IntMasterEnable();
+
+    uint64_t start = tick_us();
+    if (t->period_ms) jitter_record(JIT_TICK_DISPATCH, (uint32_t)(start - release_us));
+    t->fn();
+    uint64_t end = tick_us();
+
+    uint32_t run_us = (uint32_t)(end - start);
+    t->st.runs++;
+    t->st.total_us += run_us;
+    if (run_us > t->st.max_us) t->st.max_us = run_us;
+    if (end > release_us + (uint64_t)t->deadline_ms * 1000u) t->st.overruns++;
+    return true;
+}
+
+bool task_get_stats(int id, task_stats_t *out)
+{
+    if (!out || id < 0 || id >= TASK_MAX || !(g_created & (1u << id))) return false;
+    *out = g_tasks[id].st;
+    return true;
+}
+
+void task_reset_stats(void)
+{
+    for (int i = 0; i < TASK_MAX; i++) {
+        const char *name = g_tasks[i].st.name;
+        memset(&g_tasks[i].st, 0, sizeof(g_tasks[i].st));
+        g_tasks[i].st.name = name;
+    }
+}
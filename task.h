@@ -0,0 +1,45 @@
+#ifndef USER_TASK_H
+#define USER_TASK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Small cooperative run-queue scheduler.
+// Each task has a unique priority (0 = most urgent), which is also its id.
+// Periodic tasks are released from SysTick; event tasks are released with
+// task_post() (safe from ISRs). The main loop calls task_run_next(), which
+// runs the most urgent ready task to completion and returns, so a long
+// low-priority task delays others by at most its own run time.
+
+#define TASK_MAX 8
+
+typedef void (*task_fn_t)(void);
+
+typedef struct {
+    const char *name;
+    uint32_t runs;
+    uint32_t overruns;   // finished later than release + deadline
+    uint32_t missed;     // released again before the previous release ran
+    uint32_t max_us;     // longest single run
+    uint64_t total_us;   // sum of run times (mean = total_us / runs)
+} task_stats_t;
+
+// Register a task at priority 'prio' (< TASK_MAX). period_ms == 0 makes it
+// an event task. deadline_ms is relative to release (0 = same as period).
+// Returns the task id (== prio) or -1 if the slot is taken/invalid.
+int task_create(const char *name, task_fn_t fn, uint8_t prio,
+                uint32_t period_ms, uint32_t deadline_ms);
+
+// Release due periodic tasks; call once per ms from the SysTick handler.
+void task_tick_isr(void);
+
+// Mark a task ready (ISR or task context).
+void task_post(int id);
+
+// Run the most urgent ready task. Returns false if nothing was ready.
+bool task_run_next(void);
+
+bool task_get_stats(int id, task_stats_t *out);
+void task_reset_stats(void);
+
+#endif // USER_TASK_H
@@ -0,0 +1,63 @@
+#include "tick.h"
+
+#include "inc/hw_nvic.h"
+#include "inc/hw_types.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/systick.h"
+
+// Written only by tick_isr(). 64-bit loads are not atomic on Cortex-M4, so
+// readers use the double-read loop in tick_ms()/tick_us().
+static volatile uint64_t g_ms = TICK_INITIAL_MS;
+
+void tick_init(void)
+{
+    SysTickPeriodSet(SysCtlClockGet() / 1000u);
+}
+
+void tick_isr(void)
+{
+    g_ms++;
+}
+
+uint64_t tick_ms(void)
+{
+    uint64_t a, b;
+    do {
+        a = g_ms;
+        b = g_ms;
+    } while (a != b);
+    return a;
+}
+
+uint64_t tick_us(void)
+{
+    uint64_t a, b;
+    uint32_t val;
+    bool pending;
+    // If the SysTick ISR runs between the two reads of g_ms, retry
+    do {
+        a = g_ms;
+        val = SysTickValueGet();
+        pending = (HWREG(NVIC_INT_CTRL) & NVIC_INT_CTRL_PEND_STSET) != 0u;
+        b = g_ms;
+    } while (a != b);
+
+    // With interrupts masked, or inside another ISR, SysTick can reload
+    // while its ISR is still pending, leaving g_ms one behind 'val'. 'val'
+    // is read before the pending bit, so pending plus a count in the upper
+    // half means the reload already happened (valid while the ISR is held
+    // off for less than half a millisecond); a count near zero was read
+    // just before the reload and still belongs to g_ms.
+    uint32_t period = SysTickPeriodGet();
+    if (pending && val >= period / 2u) a++;
+
+    // elapsed * 1000 stays below 2^32 for any SysTick period under 4.29M
+    // cycles, so this is a single hardware divide (cheap enough for ISRs)
+    uint32_t elapsed = (period - 1u) - val;   // counts down from period-1
+    return a * 1000u + (elapsed * 1000u) / period;
+}
+
+uint32_t millis(void)
+{
+    return (uint32_t)tick_ms();
+}
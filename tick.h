@@ -0,0 +1,66 @@
+#ifndef USER_TICK_H
+#define USER_TICK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Monotonic system time (SysTick @1kHz, extended to 64 bits in software).
+// A 64-bit millisecond counter does not wrap within the life of the device,
+// so plain comparisons are safe everywhere (the old 32-bit millis() wrapped
+// after ~49.7 days).
+
+// Start value of the millisecond counter. Override at build time to move the
+// legacy 32-bit wrap point close to boot, e.g. -DTICK_INITIAL_MS=0xFFFF0000
+// crosses the old millis() wrap ~65 s after power-up.
+#ifndef TICK_INITIAL_MS
+#define TICK_INITIAL_MS 0ull
+#endif
+
+// Configure SysTick for a 1 ms period. Interrupts are enabled by the caller.
+void tick_init(void);
+
+// Advance the millisecond counter; call once from the SysTick handler.
+void tick_isr(void);
+
+// Milliseconds / microseconds since boot (plus TICK_INITIAL_MS).
+// Microseconds are interpolated from the SysTick down-counter.
+uint64_t tick_ms(void);
+uint64_t tick_us(void);
+
+// Legacy 32-bit view of tick_ms(). Wraps; prefer tick_ms()/deadline_t.
+uint32_t millis(void);
+
+// ---------------------------------------------------------------------------
+// Deadlines
+// ---------------------------------------------------------------------------
+
+// Absolute point in tick_ms() time
+typedef struct {
+    uint64_t at_ms;
+} deadline_t;
+
+static inline deadline_t deadline_in_ms(uint32_t ms)
+{
+    deadline_t d = { tick_ms() + ms };
+    return d;
+}
+
+static inline deadline_t deadline_at_ms(uint64_t at_ms)
+{
+    deadline_t d = { at_ms };
+    return d;
+}
+
+static inline bool deadline_expired(deadline_t d)
+{
+    return tick_ms() >= d.at_ms;
+}
+
+// Milliseconds left until expiry (0 if already expired)
+static inline uint64_t deadline_remaining_ms(deadline_t d)
+{
+    uint64_t now = tick_ms();
+    return (now >= d.at_ms) ? 0u : (d.at_ms - now);
+}
+
+#endif // USER_TICK_H
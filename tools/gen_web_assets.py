@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+"""Build web_assets.h from the pages in web/.
+
+Each asset is minified, gzipped and written as a PROGMEM byte array with
+its content type, ETag and cache policy. The ESP32 serves the bytes as-is
+with Content-Encoding: gzip.
+
+Pages keep their fixed URLs and must be revalidated (no-cache + ETag).
+The stylesheets and scripts they reference are renamed to
+<name>.<hash>.<ext>; those URLs change whenever the content does, so they
+are cached as immutable.
+
+Run after editing anything in web/ and commit the regenerated header:
+    python3 tools/gen_web_assets.py
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB_DIR = os.path.join(ROOT, "web")
+OUT = os.path.join(ROOT, "web_assets.h")
+
+# (source, URL path, C identifier); pages are listed last so that the
+# hashed names of what they reference are known
+PAGES = [
+    ("config.html", "/wifi", "WEB_CONFIG_PAGE"),
+    ("home.html", "/", "WEB_HOME_PAGE"),
+]
+SUBRESOURCES = [
+    ("home.css", "WEB_HOME_CSS"),
+    ("home.js", "WEB_HOME_JS"),
+]
+
+TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+}
+
+
+def minify_css(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    out = []
+    for line in text.splitlines():
+        line = line.strip()
+        if line:
+            out.append(line)
+    text = " ".join(out)
+    text = re.sub(r"\s*([{};,>])\s*", r"\1", text)
+    text = re.sub(r":\s+", ":", text)
+    return text.replace(";}", "}")
+
+
+def minify_js(text):
+    # Conservative: drop indentation, blank lines and whole-line comments.
+    # Line breaks are kept so automatic semicolon insertion is unaffected.
+    out = []
+    for line in text.splitlines():
+        line = line.strip()
+        if line and not line.startswith("//"):
+            out.append(line)
+    return "\n".join(out)
+
+
+def minify_html(text):
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    text = re.sub(r"<style>(.*?)</style>",
+                  lambda m: "<style>" + minify_css(m.group(1)) + "</style>",
+                  text, flags=re.S)
+    text = re.sub(r"<script>(.*?)</script>",
+                  lambda m: "<script>" + minify_js(m.group(1)) + "</script>",
+                  text, flags=re.S)
+    out = []
+    for line in text.splitlines():
+        line = line.strip()
+        if line:
+            out.append(line)
+    return "\n".join(out)
+
+
+def minify(name, text):
+    ext = os.path.splitext(name)[1]
+    if ext == ".css":
+        return minify_css(text)
+    if ext == ".js":
+        return minify_js(text)
+    return minify_html(text)
+
+
+def read(name):
+    with open(os.path.join(WEB_DIR, name), encoding="utf-8") as f:
+        return f.read()
+
+
+def c_array(ident, data):
+    lines = ["static const uint8_t %s_GZ[] PROGMEM = {" % ident]
+    for i in range(0, len(data), 16):
+        chunk = ", ".join("0x%02x" % b for b in data[i:i + 16])
+        lines.append("    %s," % chunk)
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def build(name, path, ident, text, immutable):
+    raw = minify(name, text).encode("utf-8")
+    digest = hashlib.sha256(raw).hexdigest()
+    gz = gzip.compress(raw, compresslevel=9, mtime=0)
+    return {
+        "name": name,
+        "path": path,
+        "ident": ident,
+        "type": TYPES[os.path.splitext(name)[1]],
+        "etag": '"%s"' % digest[:16],
+        "hash": digest[:8],
+        "immutable": immutable,
+        "src_len": len(text.encode("utf-8")),
+        "raw_len": len(raw),
+        "gz": gz,
+    }
+
+
+def main():
+    assets = []
+    renames = {}
+    for name, ident in SUBRESOURCES:
+        stem, ext = os.path.splitext(name)
+        a = build(name, None, ident, read(name), True)
+        a["path"] = "/%s.%s%s" % (stem, a["hash"], ext)
+        renames[name] = a["path"]
+        assets.append(a)
+
+    for name, path, ident in PAGES:
+        text = read(name)
+        for src, dst in renames.items():
+            text = text.replace('href="%s"' % src, 'href="%s"' % dst)
+            text = text.replace('src="%s"' % src, 'src="%s"' % dst)
+        assets.append(build(name, path, ident, text, False))
+
+    out = [
+        "// Generated by tools/gen_web_assets.py from web/. Do not edit.",
+        "#ifndef USER_WEB_ASSETS_H",
+        "#define USER_WEB_ASSETS_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "struct WebAsset {",
+        "    const char *path;",
+        "    const char *type;",
+        "    const uint8_t *gz;     // gzip body",
+        "    size_t gzLen;",
+        "    const char *etag;      // quoted content hash",
+        "    bool immutable;        // versioned URL, cache forever",
+        "};",
+        "",
+    ]
+    for a in assets:
+        out.append("// %s: %d bytes, %d minified, %d gzipped" %
+                   (a["name"], a["src_len"], a["raw_len"], len(a["gz"])))
+        out.append(c_array(a["ident"], a["gz"]))
+        out.append("static const WebAsset %s = {%s, %s, %s_GZ, sizeof(%s_GZ), %s, %s};" % (
+            a["ident"], c_str(a["path"]), c_str(a["type"]), a["ident"],
+            a["ident"], c_str(a["etag"]), "true" if a["immutable"] else "false"))
+        out.append("")
+
+    versioned = [a for a in assets if a["immutable"]]
+    out.append("// Versioned assets, registered by path")
+    out.append("static const WebAsset *const WEB_VERSIONED_ASSETS[] = {")
+    for a in versioned:
+        out.append("    &%s," % a["ident"])
+    out.append("};")
+    out.append("")
+    out.append("#endif // USER_WEB_ASSETS_H")
+    out.append("")
+
+    with open(OUT, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out))
+
+    for a in assets:
+        print("%-12s %-24s %6d -> %6d -> %6d bytes" %
+              (a["name"], a["path"], a["src_len"], a["raw_len"], len(a["gz"])))
+    return 0
+
+
+def c_str(s):
+    return '"%s"' % s.replace("\\", "\\\\").replace('"', '\\"')
+
+
+if __name__ == "__main__":
+    sys.exit(main())
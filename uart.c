@@ -2,16 +2,26 @@
 // - 硬件模块：UART1（从UART0迁移）
 // - 物理引脚：PC4 (U1RX), PC5 (U1TX)
 // - 用途：    ESP32通信（AT命令协议）
-// - 波特率：  115200 8N1
+// - 波特率：  上电115200 8N1；可经AT+BAUD协商提速（230400/460800/921600），
+//             失败或复位后回落到115200
 // - 时钟源：  PIOSC 16MHz（温度稳定）
-// - RX缓冲：  512字节中断驱动环形缓冲区
+// - RX缓冲：  2048字节中断驱动SPSC环形缓冲区（spsc_ring.h），
+//             溢出/高水位/线路错误计数可通过AT+UARTSTAT查询
+// - TX缓冲：  1024字节环形缓冲区，由TX中断送入FIFO；写满时等待，
+//             若对端已XOFF则丢弃并计数（不忙等）
+// - 流控：    软件XON/XOFF。RX缓冲达到3/4时发送XOFF，降到1/4时发送XON；
+//             收到的XON/XOFF控制本端发送，且不写入RX缓冲
 //
 // 注意：公共API保留"UART0"命名以保持向后兼容性
 
 #include "uart.h"
+#include "tick.h"
+#include "jitter.h"
+#include "spsc_ring.h"
 
 #include "inc/hw_ints.h"
 #include "inc/hw_memmap.h"
+#include "inc/hw_uart.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/gpio.h"
 #include "driverlib/uart.h"
@@ -20,53 +30,121 @@
 #include <stdarg.h>
 #include <stdio.h>
 
-// RX ring buffer
+// RX ring buffer (power of two; see spsc_ring.h)
 #define UART0_RX_BUF_SZ 2048u
-static volatile unsigned int rx_head = 0; // index [0..UART0_RX_BUF_SZ-1]
-static volatile unsigned int rx_tail = 0;
-static volatile char rx_buf[UART0_RX_BUF_SZ];
-
-// ISR Context: Only modifies rx_head
-static inline void rx_push_char(char c)
-{
-    unsigned int next = (rx_head + 1u) % UART0_RX_BUF_SZ;
-    
-    // FIX: Race condition solved by "Drop New" policy.
-    // If buffer is full, we do NOT touch rx_tail (which main loop owns).
-    // We simply discard the incoming character.
-    if (next != rx_tail) {
-        rx_buf[rx_head] = c;
-        rx_head = next;
+static uint8_t rx_buf[UART0_RX_BUF_SZ];
+static spsc_ring_t rx_ring;
+static void (*volatile rx_callback)(void) = 0;
+
+// TX ring: filled by UARTprintf (task context), drained into the hardware
+// FIFO by the UART ISR, so output never waits on the line
+#define UART0_TX_BUF_SZ 1024u
+static uint8_t tx_buf[UART0_TX_BUF_SZ];
+static spsc_ring_t tx_ring;
+
+// Software flow control (XON/XOFF) on ring watermarks
+#define FLOW_XON  0x11
+#define FLOW_XOFF 0x13
+#define UART0_RX_XOFF_LEVEL (UART0_RX_BUF_SZ * 3u / 4u)
+#define UART0_RX_XON_LEVEL  (UART0_RX_BUF_SZ / 4u)
+// A lost XON must not stall our TX forever
+#define UART0_TX_PAUSE_MAX_MS 200u
+static volatile bool rx_xoff = false;       // peer has been told to stop
+static volatile uint8_t flow_pending = 0;   // XON/XOFF that found the TX FIFO full
+static volatile bool tx_paused = false;     // peer told us to stop
+static deadline_t tx_pause_limit;           // ignore the pause after this
+static volatile uint32_t rx_xoff_count = 0;
+static volatile uint32_t tx_dropped = 0;    // output lost while paused and full
+
+static uint32_t link_baud = UART_LINK_DEFAULT_BAUD;
+
+// Line error counters, ISR only
+static volatile uint32_t rx_bytes = 0;
+static volatile uint32_t rx_framing = 0;
+static volatile uint32_t rx_parity = 0;
+static volatile uint32_t rx_break = 0;
+static volatile uint32_t rx_overrun = 0;
+
+// Queue a flow-control byte ahead of normal output. If the TX FIFO is
+// full it is retried by the next write or consume.
+static void flow_send(uint8_t c)
+{
+    flow_pending = UARTCharPutNonBlocking(UART1_BASE, c) ? 0u : c;
+}
+
+// Move queued output into the hardware FIFO and keep the TX interrupt
+// enabled only while there is something left to move. ISR, or interrupts
+// masked. The TX interrupt fires when the FIFO drains through its trigger
+// level, so writers call this once to prime it.
+static void tx_fill(void)
+{
+    if (flow_pending) flow_send(flow_pending);
+    if (!tx_paused) {
+        const uint8_t *p;
+        uint32_t n;
+        while ((n = spsc_ring_read_span(&tx_ring, &p)) != 0u) {
+            uint32_t sent = 0;
+            while (sent < n && UARTCharPutNonBlocking(UART1_BASE, p[sent])) sent++;
+            spsc_ring_consume(&tx_ring, sent);
+            if (sent < n) break;
+        }
+    }
+    if (flow_pending || (!tx_paused && spsc_ring_used(&tx_ring))) {
+        UARTIntEnable(UART1_BASE, UART_INT_TX);
     } else {
-        // Buffer overflow: Byte dropped. 
-        // Optional: Set a flag here if you want to detect overflow.
+        UARTIntDisable(UART1_BASE, UART_INT_TX);
     }
 }
 
-// Main Loop Context: Only modifies rx_tail
-static bool rx_pop_char(char *c)
+// A lost XON must not stall output forever. Task context.
+static void tx_pause_check(void)
 {
-    if (rx_tail == rx_head) return false;
-    
-    *c = rx_buf[rx_tail];
-    // Atomic read of rx_tail is safe.
-    // We are the only writer to rx_tail, so no interrupt disable needed.
-    rx_tail = (rx_tail + 1u) % UART0_RX_BUF_SZ;
-    
-    return true;
+    if (!tx_paused) return;
+    bool was_masked = IntMasterDisable();   // the ISR writes the limit
+    if (tx_paused && deadline_expired(tx_pause_limit)) {
+        tx_paused = false;
+        tx_fill();
+    }
+    if (!was_masked) IntMasterEnable();
 }
 
 static void UART1IntHandler(void)
 {
+    uint64_t t_enter = tick_us();
     uint32_t status = UARTIntStatus(UART1_BASE, true);
     UARTIntClear(UART1_BASE, status);
     if (status & (UART_INT_RX | UART_INT_RT)) {
         while (UARTCharsAvail(UART1_BASE)) {
             int32_t ch = UARTCharGetNonBlocking(UART1_BASE);
-            if (ch >= 0) rx_push_char((char)ch);
-            else break;
+            if (ch < 0) break;
+            // The data register carries per-character error flags. A FIFO
+            // overrun is flagged on the next good byte, which is kept.
+            if (ch & UART_DR_OE) rx_overrun++;
+            if (ch & (UART_DR_FE | UART_DR_PE | UART_DR_BE)) {
+                if (ch & UART_DR_FE) rx_framing++;
+                if (ch & UART_DR_PE) rx_parity++;
+                if (ch & UART_DR_BE) rx_break++;
+                continue;
+            }
+            uint8_t b = (uint8_t)ch;
+            if (b == FLOW_XOFF) {
+                tx_paused = true;
+                tx_pause_limit = deadline_in_ms(UART0_TX_PAUSE_MAX_MS);
+                continue;
+            }
+            if (b == FLOW_XON) { tx_paused = false; continue; }
+            rx_bytes++;
+            spsc_ring_push(&rx_ring, b);
+        }
+        if (!rx_xoff && spsc_ring_used(&rx_ring) >= UART0_RX_XOFF_LEVEL) {
+            rx_xoff = true;
+            rx_xoff_count++;
+            flow_send(FLOW_XOFF);
         }
+        if (rx_callback) rx_callback();
     }
+    tx_fill();
+    jitter_record(JIT_UART_RX_ISR, (uint32_t)(tick_us() - t_enter));
 }
 
 void UART0_ConsoleInit(uint32_t baud)
@@ -90,28 +168,97 @@ void UART0_ConsoleInit(uint32_t baud)
     UARTConfigSetExpClk(UART1_BASE, 16000000, baud,
                         (UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE | UART_CONFIG_PAR_NONE));
     UARTEnable(UART1_BASE);
+    link_baud = baud;
 
     // Enable FIFO with mid thresholds
     UARTFIFOLevelSet(UART1_BASE, UART_FIFO_TX4_8, UART_FIFO_RX4_8);
     UARTFIFOEnable(UART1_BASE);
 
-    // Enable RX interrupts and register handler
+    // Enable RX interrupts and register handler (TX is enabled on demand)
     IntDisable(INT_UART1);
+    spsc_ring_init(&rx_ring, rx_buf, UART0_RX_BUF_SZ);
+    spsc_ring_init(&tx_ring, tx_buf, UART0_TX_BUF_SZ);
     UARTIntDisable(UART1_BASE, 0xFFFFFFFF);
     UARTIntRegister(UART1_BASE, UART1IntHandler);
     UARTIntEnable(UART1_BASE, UART_INT_RX | UART_INT_RT);
     IntEnable(INT_UART1);
 }
 
+bool UART0_BaudSupported(uint32_t baud)
+{
+    switch (baud) {
+    case 115200u: case 230400u: case 460800u: case 921600u:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void UART0_SetBaud(uint32_t baud)
+{
+    if (!UART0_BaudSupported(baud)) return;
+    // Let the last reply leave at the old rate. Output held by an XOFF
+    // would go out garbled at the new one, so it is dropped instead.
+    while (spsc_ring_used(&tx_ring) && !tx_paused) {}
+    bool was_masked = IntMasterDisable();
+    tx_dropped += spsc_ring_used(&tx_ring);
+    spsc_ring_consume(&tx_ring, spsc_ring_used(&tx_ring));
+    tx_fill();
+    if (!was_masked) IntMasterEnable();
+    while (UARTBusy(UART1_BASE)) {}
+    UARTConfigSetExpClk(UART1_BASE, 16000000, baud,
+                        (UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE | UART_CONFIG_PAR_NONE));
+    link_baud = baud;
+}
+
+uint32_t UART0_GetBaud(void)
+{
+    return link_baud;
+}
+
+// Send any deferred XON/XOFF (interrupts masked so the ISR cannot race)
+static void flow_flush(void)
+{
+    if (!flow_pending) return;
+    bool was_masked = IntMasterDisable();
+    if (flow_pending) flow_send(flow_pending);
+    if (!was_masked) IntMasterEnable();
+}
+
+// Queue one byte. A full ring drains at line rate, so it is waited for
+// unless the peer has paused us; then the byte is dropped and counted
+// rather than stalling every other task.
+static void tx_kick(void)
+{
+    bool was_masked = IntMasterDisable();
+    tx_fill();
+    if (!was_masked) IntMasterEnable();
+}
+
+static void uart0_putc(char c)
+{
+    while (spsc_ring_used(&tx_ring) >= UART0_TX_BUF_SZ) {
+        tx_pause_check();
+        if (tx_paused) {
+            tx_dropped++;
+            return;
+        }
+        tx_kick();
+    }
+    spsc_ring_push(&tx_ring, (uint8_t)c);
+}
+
 // Minimal printf over UART1
 static void uart0_write(const char *s)
 {
+    tx_pause_check();
     while (*s) {
         if (*s == '\n') {
-            UARTCharPut(UART1_BASE, '\r');
+            uart0_putc('\r');
         }
-        UARTCharPut(UART1_BASE, *s++);
+        uart0_putc(*s++);
     }
+    tx_kick();
 }
 
 void UARTprintf(const char *fmt, ...)
@@ -124,8 +271,65 @@ void UARTprintf(const char *fmt, ...)
     uart0_write(buf);
 }
 
+void UART0_SetRxCallback(void (*cb)(void))
+{
+    rx_callback = cb;
+}
+
 bool UART0_ReadChar(char *ch)
 {
     if (!ch) return false;
-    return rx_pop_char(ch);
+    const char *p;
+    if (UART0_RxSpan(&p) == 0) return false;
+    *ch = *p;
+    UART0_RxConsume(1u);
+    return true;
+}
+
+uint32_t UART0_RxSpan(const char **p)
+{
+    return spsc_ring_read_span(&rx_ring, (const uint8_t **)p);
+}
+
+void UART0_RxConsume(uint32_t n)
+{
+    spsc_ring_consume(&rx_ring, n);
+    tx_pause_check();
+    if (rx_xoff && spsc_ring_used(&rx_ring) <= UART0_RX_XON_LEVEL) {
+        bool was_masked = IntMasterDisable();
+        rx_xoff = false;
+        flow_send(FLOW_XON);
+        if (!was_masked) IntMasterEnable();
+    } else {
+        flow_flush();
+    }
+}
+
+void UART0_GetRxStats(uart_rx_stats_t *out)
+{
+    if (!out) return;
+    out->bytes = rx_bytes;
+    out->overflows = rx_ring.overflows;
+    out->high_water = rx_ring.high_water;
+    out->size = spsc_ring_size(&rx_ring);
+    out->framing = rx_framing;
+    out->parity = rx_parity;
+    out->brk = rx_break;
+    out->overrun = rx_overrun;
+    out->xoff = rx_xoff_count;
+    out->tx_dropped = tx_dropped;
+}
+
+void UART0_ResetRxStats(void)
+{
+    bool was_masked = IntMasterDisable();
+    rx_bytes = 0;
+    rx_framing = 0;
+    rx_parity = 0;
+    rx_break = 0;
+    rx_overrun = 0;
+    rx_xoff_count = 0;
+    tx_dropped = 0;
+    spsc_ring_reset_stats(&rx_ring);
+    if (!was_masked) IntMasterEnable();
 }
@@ -4,13 +4,54 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+// Link rate after reset, and the fallback when a faster rate fails
+#define UART_LINK_DEFAULT_BAUD 115200u
+
 // Initialize UART0 as console for JSON line I/O (PC via ICDI)
 void UART0_ConsoleInit(uint32_t baud);
 
+// Runtime rate change (AT+BAUD). Rates are limited to those the 16 MHz
+// PIOSC divides to within 1%. SetBaud waits for pending TX to drain.
+bool UART0_BaudSupported(uint32_t baud);
+void UART0_SetBaud(uint32_t baud);
+uint32_t UART0_GetBaud(void);
+
+// The link uses software XON/XOFF flow control: XOFF (0x13) is sent when
+// the RX ring is 3/4 full and XON (0x11) once it drains to 1/4. Received
+// XON/XOFF pause our own output and are never delivered to readers.
+// Output is queued in a TX ring that the UART interrupt drains, so
+// UARTprintf() does not wait for the line or for an XON.
+
 // Non-blocking read of one character from UART RX ring buffer
 // Returns true and writes to *ch when a character is available.
 bool UART0_ReadChar(char *ch);
 
+// Bulk read: points *p at the oldest buffered bytes and returns how many
+// are contiguous there (0 if none). Call UART0_RxConsume() once handled.
+uint32_t UART0_RxSpan(const char **p);
+void UART0_RxConsume(uint32_t n);
+
+// Link health, for field diagnostics
+typedef struct {
+    uint32_t bytes;       // bytes accepted into the ring
+    uint32_t overflows;   // bytes dropped because the ring was full
+    uint32_t high_water;  // peak ring fill
+    uint32_t size;        // ring capacity
+    uint32_t framing;     // bytes dropped with a framing error
+    uint32_t parity;
+    uint32_t brk;         // break conditions
+    uint32_t overrun;     // hardware FIFO overruns
+    uint32_t xoff;        // times the peer was paused with XOFF
+    uint32_t tx_dropped;  // output bytes dropped while we were paused
+} uart_rx_stats_t;
+
+void UART0_GetRxStats(uart_rx_stats_t *out);
+void UART0_ResetRxStats(void);
+
+// Optional hook called from the RX ISR after new bytes were buffered
+// (e.g. to release the task that drains the buffer). NULL disables it.
+void UART0_SetRxCallback(void (*cb)(void));
+
 // Minimal printf over UART0
 void UARTprintf(const char *fmt, ...);
 
@@ -0,0 +1,415 @@
+// --- 1. DEVICE DATA ---
+// Pulls from ESP32 mock API for now; swap to TM4C UART later.
+let deviceData = {
+    foodBowl: 0,
+    waterBowl: 0,
+    timeWarn: false,
+    alarm: 0,
+    schedule: []
+};
+const ALARM_FOOD_SENSOR = 0x02;
+const ALARM_WATER_SENSOR = 0x04;
+const FOOD_LOW_BADGE = 50;
+const WATER_LOW = 80;
+
+const MAX_SCHEDULES = 8;
+const AMOUNT_LABEL = { L: "L · Small", M: "M · Mid", H: "H · High" };
+
+function labelForAmount(code) {
+    const c = (code || "").toUpperCase();
+    return AMOUNT_LABEL[c] || c || "--";
+}
+
+// --- 2. UPDATE UI FUNCTIONS ---
+
+function updateStatus() {
+    // Food Bowl
+    const foodVal = Math.min(999, Math.max(0, deviceData.foodBowl));
+    document.getElementById('val-food-bowl').textContent = foodVal + "g";
+    const lowChip = document.getElementById('food-low-chip');
+    lowChip.style.display = (foodVal < FOOD_LOW_BADGE) ? 'inline-flex' : 'none';
+
+    // Water Bowl
+    const wbEl = document.getElementById('val-water-bowl');
+    const waterVal = Math.min(999, Math.max(0, deviceData.waterBowl));
+    wbEl.textContent = waterVal + "g";
+    if(waterVal < WATER_LOW) {
+        wbEl.classList.add('is-alert');
+        wbEl.classList.remove('is-ok');
+    } else {
+        wbEl.classList.add('is-ok');
+        wbEl.classList.remove('is-alert');
+    }
+
+    // Alerts summary
+    const alerts = [];
+    if (waterVal < WATER_LOW) alerts.push("Water bowl is LOW");
+    if (deviceData.timeWarn) alerts.push("Clock not synced");
+    if (deviceData.alarm & ALARM_FOOD_SENSOR) alerts.push("Food scale not responding");
+    if (deviceData.alarm & ALARM_WATER_SENSOR) alerts.push("Water scale not responding");
+    const banner = document.getElementById('alert-banner');
+    if (alerts.length) {
+        banner.style.display = 'block';
+        banner.textContent = alerts.join(" · ");
+    } else {
+        banner.style.display = 'none';
+        banner.textContent = "";
+    }
+}
+
+function renderSchedule() {
+    const container = document.getElementById('schedule-container');
+    const btn = document.getElementById('addBtn');
+    const countLabel = document.getElementById('schedule-count');
+
+    container.innerHTML = '';
+
+    // Sort by time
+    deviceData.schedule.sort((a, b) => a.time.localeCompare(b.time));
+
+    deviceData.schedule.forEach((item, index) => {
+        const div = document.createElement('div');
+        div.className = 'schedule-item';
+        div.innerHTML = `
+            <div style="display:flex; align-items:center">
+                <span class="sch-time">${item.time}</span>
+                <span class="sch-amount">${labelForAmount(item.amount)}</span>
+            </div>
+            <button class="del-btn" onclick="deleteSchedule(${index})">✕</button>
+        `;
+        container.appendChild(div);
+    });
+
+    // Update Counter
+    countLabel.textContent = `${deviceData.schedule.length}/${MAX_SCHEDULES}`;
+
+    // Disable button if full
+    if(deviceData.schedule.length >= MAX_SCHEDULES) {
+        btn.disabled = true;
+        btn.textContent = "Max 8 Reached";
+    } else {
+        btn.disabled = false;
+        btn.textContent = "+ Add Schedule";
+    }
+}
+
+// --- 3. ACTIONS ---
+
+function openSettings() {
+    window.location.href = "/wifi";
+}
+
+const feedModal = document.getElementById('feedOverlay');
+
+function openFeedModal() {
+    feedModal.style.display = 'flex';
+}
+
+function closeFeedModal() {
+    feedModal.style.display = 'none';
+}
+
+async function sendFeed(level) {
+    closeFeedModal();
+    const btn = document.getElementById('feedBtn');
+    const prevText = btn.textContent;
+    btn.textContent = `Feeding ${level}...`;
+    btn.disabled = true;
+    try {
+        const body = new URLSearchParams();
+        body.append('level', level);
+        const res = await fetch('/api/feed_now', {
+            method: 'POST',
+            headers: { 'Content-Type': 'application/x-www-form-urlencoded' },
+            body: body.toString()
+        });
+        if (!res.ok) {
+            throw new Error(await res.text());
+        }
+        btn.textContent = `Fed (${level})`;
+        setTimeout(()=>{
+            btn.textContent = 'Feed Now';
+            btn.disabled = false;
+        }, 1500);
+    } catch (e) {
+        alert('Feed failed: ' + e.message);
+        btn.textContent = prevText;
+        btn.disabled = false;
+    }
+}
+
+feedModal.addEventListener('click', (e)=>{
+    if (e.target === feedModal) closeFeedModal();
+});
+
+const cloneSchedule = () => deviceData.schedule.map(item => ({ time: item.time, amount: item.amount }));
+const delay = (ms) => new Promise(resolve => setTimeout(resolve, ms));
+
+function showLoading(text = 'Saving...') {
+    document.getElementById('loadingText').textContent = text;
+    document.getElementById('loadingOverlay').style.display = 'flex';
+}
+
+function hideLoading() {
+    document.getElementById('loadingOverlay').style.display = 'none';
+}
+
+async function deleteSchedule(index) {
+    if(confirm("Remove this feeding time?")) {
+        showLoading('Deleting...');
+        const prev = cloneSchedule();
+        deviceData.schedule.splice(index, 1);
+        renderSchedule();
+        const ok = await sendDataToESP(); // Sync
+        hideLoading();
+        if (!ok) {
+            deviceData.schedule = prev;
+            renderSchedule();
+        }
+    }
+}
+
+// Modal Logic
+const modal = document.getElementById('modalOverlay');
+
+function openModal() {
+    if(deviceData.schedule.length >= MAX_SCHEDULES) return;
+    // Default time to now
+    const now = new Date();
+    const timeStr = now.toTimeString().substring(0,5);
+    document.getElementById('inputTime').value = timeStr;
+    modal.style.display = 'flex';
+}
+
+function closeModal() {
+    modal.style.display = 'none';
+}
+
+async function saveSchedule() {
+    const time = document.getElementById('inputTime').value;
+    const amount = document.getElementById('inputAmount').value.toUpperCase();
+
+    if(!time) return;
+
+    // --- Check for Duplicates ---
+    // Frontend check to prevent same time
+    const exists = deviceData.schedule.some(item => item.time === time);
+    if (exists) {
+        alert("This time is already scheduled! \nPlease choose a different time. (=^･ω･^=)");
+        return;
+    }
+
+    closeModal();
+    showLoading('Saving schedule...');
+    const prev = cloneSchedule();
+    deviceData.schedule.push({ time, amount });
+    renderSchedule();
+    const ok = await sendDataToESP(); // Sync
+    hideLoading();
+    if (!ok) {
+        deviceData.schedule = prev;
+        renderSchedule();
+    }
+}
+
+// --- 4. DATA SYNC (Simulated) ---
+async function loadStatus() {
+    const res = await fetch('/api/status');
+    applyStatus(await res.json());
+}
+
+function applyStatus(json) {
+    deviceData.foodBowl = Math.min(999, Math.max(0, json.foodBowl ?? deviceData.foodBowl));
+    deviceData.waterBowl = Math.min(999, Math.max(0, json.waterBowl ?? deviceData.waterBowl));
+    deviceData.timeWarn = !!json.timeWarn;
+    deviceData.alarm = json.alarm | 0;
+}
+
+async function loadSchedule() {
+    const res = await fetch('/api/schedule');
+    const json = await res.json();
+    applySchedule(Array.isArray(json) ? json : json.items);
+}
+
+function applySchedule(list) {
+    deviceData.schedule = Array.isArray(list) ? list.map(item => ({
+        time: item.time || "",
+        amount: (item.amount || '').toUpperCase()
+    })) : [];
+}
+
+// One request (one AT+SNAPSHOT on the device) for status and schedule
+async function loadSnapshot() {
+    const res = await fetch('/api/snapshot');
+    if (!res.ok) throw new Error('snapshot ' + res.status);
+    const json = await res.json();
+    applyStatus(json);
+    applySchedule(json.schedule);
+}
+
+async function sendDataToESP() {
+    const payload = JSON.stringify(deviceData.schedule);
+    try {
+        // Send schedule update request (returns immediately)
+        const res = await fetch('/api/schedule', {
+            method: 'POST',
+            headers: { 'Content-Type': 'application/json' },
+            body: payload
+        });
+        if (!res.ok) throw new Error('Request failed');
+
+        console.log('Schedule update queued, polling for status...');
+
+        // Poll for completion
+        const maxPollTime = 35000; // 35 seconds
+        const pollInterval = 500;  // 500ms
+        const startTime = Date.now();
+
+        while (Date.now() - startTime < maxPollTime) {
+            const status = await nextTaskState(pollInterval);
+            console.log('Schedule status:', status);
+
+            if (status.status === 'success') {
+                console.log('Schedule update SUCCESS');
+                // Clear the task status
+                await fetch('/api/schedule_status?clear=1');
+                // Refresh schedule display
+                await loadSchedule();
+                renderSchedule();
+                return true;
+            } else if (status.status === 'failed') {
+                const errMsg = status.error || 'Unknown error';
+                // Clear the task status
+                await fetch('/api/schedule_status?clear=1');
+                throw new Error(errMsg);
+            } else if (status.status === 'processing') {
+                const retry = status.retry || 0;
+                console.log(`Processing... retry ${retry}`);
+                // Update loading text to show progress
+                const elapsed = Math.floor((Date.now() - startTime) / 1000);
+                showLoading(`Syncing... (retry ${retry}, ${elapsed}s)`);
+            }
+            // Continue polling if pending or processing
+        }
+
+        throw new Error('Timeout - device may be offline');
+
+    } catch (e) {
+        console.error('Schedule sync failed:', e);
+        alert(`计划保存失败: ${e.message}\n请重试 (=^･ω･^=)`);
+        await loadSchedule();
+        renderSchedule();
+        return false;
+    }
+}
+
+// Schedule task state: pushed over /ws when connected, else polled
+let taskWaiter = null;
+async function nextTaskState(pollInterval) {
+    if (pushSocket && pushSocket.readyState === WebSocket.OPEN) {
+        const pushed = await new Promise(resolve => {
+            const timer = setTimeout(() => { taskWaiter = null; resolve(null); }, 5000);
+            taskWaiter = (d) => { clearTimeout(timer); taskWaiter = null; resolve(d); };
+        });
+        if (pushed) return pushed;
+    } else {
+        await delay(pollInterval);
+    }
+    const statusRes = await fetch('/api/schedule_status');
+    if (!statusRes.ok) throw new Error('Status check failed');
+    return statusRes.json();
+}
+
+let statusTimer = null;
+function startStatusTimer() {
+    if (statusTimer) return;
+    statusTimer = setInterval(async ()=>{
+        try { await loadStatus(); updateStatus(); } catch(e){ console.warn('Status poll failed', e); }
+    }, 5000);  // Reduced polling from 3s to 5s
+}
+function stopStatusTimer() {
+    if (statusTimer) {
+        clearInterval(statusTimer);
+        statusTimer = null;
+    }
+}
+
+async function onVisibleRefresh() {
+    try {
+        try {
+            await loadSnapshot();
+        } catch (e) {
+            await Promise.all([loadStatus(), loadSchedule()]);
+        }
+        updateStatus();
+        renderSchedule();
+    } catch (e) {
+        console.warn('Visible refresh failed', e);
+    }
+}
+
+// Push channel: status, schedule, schedule-task state and TM4C events
+// arrive over /ws. While it is open the status poll is stopped; when
+// it drops, polling resumes and the socket reconnects with backoff.
+let pushSocket = null;
+let pushBackoff = 1000;
+function startPush() {
+    if (!window.WebSocket || pushSocket) return;
+    const sock = new WebSocket(`ws://${location.host}/ws`);
+    pushSocket = sock;
+    sock.onopen = () => {
+        pushBackoff = 1000;
+        stopStatusTimer();
+    };
+    sock.onmessage = (ev) => {
+        try { handlePush(JSON.parse(ev.data)); } catch (e) { console.warn('Bad push message', e); }
+    };
+    sock.onclose = () => {
+        pushSocket = null;
+        if (document.visibilityState !== 'visible') return;
+        startStatusTimer();
+        setTimeout(startPush, pushBackoff);
+        pushBackoff = Math.min(pushBackoff * 2, 30000);
+    };
+}
+function stopPush() {
+    if (pushSocket) {
+        pushSocket.onclose = null;
+        pushSocket.close();
+        pushSocket = null;
+    }
+}
+
+function handlePush(msg) {
+    if (msg.t === 'status') {
+        applyStatus(msg.d);
+        updateStatus();
+    } else if (msg.t === 'schedule') {
+        // Not while a save is in flight; its result reloads the list
+        if (!taskWaiter) {
+            applySchedule(Array.isArray(msg.d) ? msg.d : msg.d.items);
+            renderSchedule();
+        }
+    } else if (msg.t === 'task') {
+        if (taskWaiter) taskWaiter(msg.d);
+    }
+}
+
+// Initialize
+window.onload = async function() {
+    await onVisibleRefresh();
+    startStatusTimer();
+    startPush();
+};
+
+document.addEventListener('visibilitychange', async ()=>{
+    if (document.visibilityState === 'visible') {
+        await onVisibleRefresh();
+        startStatusTimer();
+        startPush();
+    } else {
+        stopStatusTimer();
+        stopPush();
+    }
+});
+
@@ -0,0 +1,562 @@
+// Generated by tools/gen_web_assets.py from web/. Do not edit.
+#ifndef USER_WEB_ASSETS_H
+#define USER_WEB_ASSETS_H
+
+#include <Arduino.h>
+
+struct WebAsset {
+    const char *path;
+    const char *type;
+    const uint8_t *gz;     // gzip body
+    size_t gzLen;
+    const char *etag;      // quoted content hash
+    bool immutable;        // versioned URL, cache forever
+};
+
+// home.css: 6517 bytes, 4929 minified, 1566 gzipped
+static const uint8_t WEB_HOME_CSS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x58, 0x6d, 0x73, 0xa3, 0x38,
+    0x0c, 0xfe, 0x2b, 0xb9, 0xed, 0xec, 0x4c, 0x73, 0x13, 0x67, 0x80, 0x86, 0x84, 0xc2, 0x97, 0xdb,
+    0x76, 0xdb, 0x8f, 0xf7, 0x1f, 0x0c, 0x98, 0xc4, 0x1b, 0xc0, 0x9c, 0x6d, 0xda, 0x66, 0x19, 0xfe,
+    0xfb, 0xc9, 0x36, 0x24, 0x60, 0x48, 0x5f, 0x66, 0xfb, 0x92, 0x49, 0x84, 0x2d, 0x4b, 0x8f, 0xa4,
+    0x47, 0x72, 0x42, 0xce, 0x98, 0x6c, 0x10, 0x8a, 0xf7, 0x28, 0x61, 0x39, 0xe3, 0xe1, 0xcd, 0xf3,
+    0xf3, 0x73, 0xf0, 0xec, 0x44, 0x08, 0x25, 0x98, 0xa7, 0x20, 0xd7, 0x12, 0xf8, 0x01, 0x49, 0xc5,
+    0x69, 0x81, 0xf9, 0x49, 0x49, 0x1e, 0x76, 0x0f, 0xde, 0x45, 0x82, 0x52, 0xcc, 0x8f, 0x4a, 0x1c,
+    0xfc, 0xd8, 0xfa, 0x20, 0x96, 0xe4, 0x4d, 0xa2, 0x02, 0xd3, 0x32, 0xbc, 0xd9, 0xfe, 0xdc, 0x3c,
+    0x6e, 0xdc, 0x5e, 0x26, 0xea, 0x38, 0xbc, 0xf9, 0xe1, 0x06, 0xc1, 0x4e, 0xe9, 0xc3, 0x39, 0xe1,
+    0x52, 0x6d, 0xf3, 0x3d, 0x5f, 0x69, 0x13, 0x75, 0x92, 0x10, 0x21, 0xc2, 0x9b, 0xc0, 0x7d, 0xdc,
+    0x05, 0x9b, 0xf6, 0xef, 0x26, 0x66, 0x6f, 0x48, 0xd0, 0xdf, 0xb4, 0xdc, 0x87, 0x31, 0xe3, 0x29,
+    0xe1, 0x08, 0x24, 0x11, 0x1c, 0xb9, 0x07, 0xdd, 0x4e, 0x54, 0xe1, 0x34, 0x55, 0xcf, 0xc0, 0xdc,
+    0x57, 0x12, 0x1f, 0xa9, 0x44, 0x12, 0x57, 0xe8, 0x40, 0xf7, 0x87, 0x1c, 0xfe, 0x65, 0xe7, 0x92,
+    0xe4, 0xb8, 0x14, 0x15, 0xe6, 0xa4, 0x94, 0x11, 0xab, 0x65, 0x4e, 0x4b, 0x12, 0x96, 0xac, 0x24,
+    0x6d, 0xcc, 0xd2, 0x53, 0x93, 0xb1, 0x52, 0xa2, 0x0c, 0x17, 0x34, 0x3f, 0x85, 0xdf, 0xfe, 0xad,
+    0x4b, 0x2a, 0xd9, 0xb7, 0x15, 0xc2, 0x55, 0x95, 0x13, 0x24, 0x4e, 0x42, 0x92, 0x62, 0x25, 0x60,
+    0x3f, 0x12, 0x84, 0xd3, 0x2c, 0x8a, 0x71, 0x72, 0xdc, 0x73, 0x56, 0x97, 0x69, 0xa7, 0xfc, 0x05,
+    0xf3, 0xdb, 0x0b, 0x7c, 0xcb, 0x68, 0x28, 0x3d, 0xc3, 0xb0, 0x3c, 0x5b, 0xea, 0x39, 0x95, 0xb2,
+    0xff, 0x0d, 0xbd, 0xd2, 0x54, 0x1e, 0xc2, 0x4d, 0x60, 0x3e, 0x1b, 0x7f, 0x16, 0xb8, 0x96, 0xac,
+    0xbd, 0xd1, 0xb0, 0xa0, 0x18, 0x97, 0x25, 0xe1, 0xcd, 0xe5, 0xc0, 0x4e, 0xa9, 0x7e, 0xda, 0x9f,
+    0x73, 0x93, 0x65, 0xd9, 0x59, 0xb7, 0xeb, 0x55, 0x6f, 0x0b, 0x77, 0x03, 0x0a, 0x3b, 0xac, 0x38,
+    0x4e, 0x69, 0x2d, 0x42, 0x2d, 0x32, 0x67, 0x00, 0x7c, 0x52, 0xb2, 0xc2, 0x88, 0xb4, 0xe7, 0xaf,
+    0x44, 0x21, 0x15, 0x06, 0x8e, 0x13, 0x69, 0xb0, 0x0f, 0x38, 0x65, 0xaf, 0x60, 0xca, 0x56, 0xe9,
+    0x52, 0x2f, 0x7c, 0x1f, 0xe3, 0x5b, 0xcf, 0xf7, 0x57, 0x81, 0xa7, 0xfe, 0x9c, 0xf5, 0x9d, 0xbf,
+    0x8c, 0xb4, 0x67, 0x18, 0x40, 0x2e, 0xc3, 0x04, 0x60, 0x25, 0xbc, 0x3d, 0x10, 0x0c, 0x47, 0x36,
+    0x29, 0x15, 0x55, 0x8e, 0x4f, 0x61, 0x96, 0x93, 0xb7, 0xe8, 0x57, 0x2d, 0x24, 0xcd, 0x4e, 0x00,
+    0x0d, 0x2c, 0x29, 0x65, 0x08, 0x41, 0x48, 0x08, 0x8a, 0x89, 0x7c, 0x25, 0xa4, 0x8c, 0xf4, 0x76,
+    0x44, 0x01, 0x60, 0xd1, 0x29, 0xb1, 0x8c, 0xf4, 0xfc, 0xea, 0xad, 0x3d, 0xb8, 0x26, 0x42, 0x90,
+    0x05, 0x24, 0xf4, 0xbc, 0xa9, 0xd9, 0xed, 0xfa, 0x88, 0x59, 0xc1, 0x7e, 0x51, 0xd4, 0x99, 0x30,
+    0x8c, 0x40, 0x97, 0x9f, 0xcb, 0xe8, 0xa2, 0x43, 0xbb, 0xde, 0x9b, 0x19, 0xe7, 0x2c, 0x39, 0xb6,
+    0x6b, 0x41, 0xa4, 0x04, 0x04, 0x05, 0x8a, 0x65, 0x39, 0x44, 0x5c, 0x65, 0x49, 0x07, 0xa6, 0x79,
+    0x3f, 0x30, 0x45, 0xa9, 0x49, 0x6a, 0x2e, 0xe0, 0xac, 0x8a, 0x51, 0x6d, 0xfe, 0x24, 0xf6, 0x90,
+    0xee, 0x80, 0x95, 0x4a, 0x3f, 0x2a, 0x29, 0x2b, 0x4d, 0x26, 0x66, 0x8c, 0x17, 0x0b, 0x80, 0x51,
+    0x8c, 0xcf, 0x0d, 0x71, 0x22, 0xe9, 0x0b, 0x69, 0xce, 0x6b, 0x42, 0xce, 0x24, 0x96, 0xe4, 0xf6,
+    0xde, 0x49, 0xc9, 0x7e, 0xd9, 0xae, 0xff, 0xab, 0x69, 0x72, 0x44, 0x6a, 0x15, 0x2b, 0xc5, 0x18,
+    0xe8, 0x3d, 0xae, 0x74, 0xf4, 0xed, 0x28, 0x43, 0xfc, 0xda, 0x75, 0x46, 0x48, 0xaa, 0x1d, 0x53,
+    0x4b, 0x43, 0xf7, 0x5a, 0x0a, 0x9f, 0xa1, 0x1a, 0x64, 0xd6, 0xd0, 0xf5, 0x71, 0x4e, 0xe9, 0x3c,
+    0x3e, 0x27, 0x9e, 0x6f, 0x85, 0x25, 0x66, 0x79, 0x3a, 0x84, 0x7c, 0xab, 0x73, 0x72, 0x90, 0x5d,
+    0x1b, 0x95, 0x5d, 0xce, 0x30, 0xbb, 0xdc, 0xe0, 0x6e, 0xe5, 0xee, 0x02, 0xc8, 0xaf, 0xcd, 0xd2,
+    0xc6, 0xf5, 0x0a, 0x82, 0xae, 0x2f, 0x16, 0x04, 0x0b, 0xb2, 0xba, 0xa8, 0x1e, 0x49, 0x2d, 0x3f,
+    0xe1, 0x99, 0x67, 0x1e, 0x5d, 0x30, 0x99, 0x82, 0x2e, 0x12, 0x28, 0xb0, 0x5b, 0x67, 0x7d, 0xbf,
+    0x5d, 0x7e, 0x80, 0x94, 0x26, 0xbd, 0xe5, 0xd0, 0x2f, 0x4d, 0x2a, 0x6b, 0x01, 0x51, 0xab, 0x05,
+    0xda, 0x73, 0x9a, 0x9e, 0xa3, 0xa4, 0x3e, 0x44, 0xea, 0x05, 0xf2, 0xa2, 0x00, 0x89, 0x24, 0x4a,
+    0x63, 0x5d, 0x94, 0x50, 0x9d, 0x19, 0x5f, 0xc0, 0xbf, 0x89, 0xa1, 0x3f, 0x89, 0xa1, 0x2e, 0x82,
+    0xb5, 0xe2, 0xe2, 0x29, 0x15, 0x74, 0x0c, 0xbd, 0xfc, 0x30, 0x36, 0x53, 0xec, 0xfd, 0x79, 0xec,
+    0xdd, 0xb9, 0xda, 0x8e, 0x2a, 0xd6, 0xa1, 0xcf, 0x09, 0x98, 0x0e, 0x78, 0x5d, 0x8b, 0x88, 0x27,
+    0x8c, 0xa9, 0xef, 0xc0, 0x1a, 0x2c, 0xcd, 0x12, 0x94, 0xe3, 0x98, 0xe4, 0x83, 0xda, 0xd6, 0xf9,
+    0x3b, 0x5f, 0x41, 0xc3, 0xd4, 0xda, 0x01, 0x51, 0xe9, 0x27, 0x17, 0xdd, 0x75, 0x55, 0x11, 0x9e,
+    0x40, 0x5c, 0xa3, 0x1c, 0xea, 0x09, 0x70, 0x50, 0x3c, 0xa3, 0xdb, 0xc2, 0x7a, 0x8a, 0xe7, 0x19,
+    0x4e, 0xf4, 0x82, 0xf3, 0x9a, 0x0c, 0xc9, 0xc5, 0x99, 0xe1, 0xc4, 0x79, 0x3a, 0xef, 0x34, 0x50,
+    0x20, 0xb6, 0xc6, 0xa2, 0x84, 0xc9, 0x69, 0x36, 0xd7, 0xe8, 0x9d, 0xc9, 0x81, 0x56, 0xcd, 0x19,
+    0x56, 0x1c, 0x0b, 0x48, 0x06, 0xa9, 0x6a, 0xcc, 0xd4, 0xad, 0x82, 0x82, 0x6b, 0x1b, 0xf4, 0xdb,
+    0x3e, 0x96, 0x7d, 0xd5, 0x58, 0xf1, 0xbe, 0xbf, 0xbf, 0xef, 0x2d, 0x37, 0x48, 0xce, 0x39, 0x32,
+    0x81, 0x46, 0xd7, 0xe4, 0x25, 0xa3, 0xa0, 0x0b, 0xef, 0x9c, 0xcd, 0xdd, 0xb8, 0xfa, 0xdf, 0xaf,
+    0x58, 0xd7, 0x5b, 0x6d, 0x77, 0x90, 0x34, 0x5e, 0x9f, 0x34, 0x73, 0x21, 0xe9, 0xbd, 0x37, 0xb5,
+    0x41, 0x85, 0xe9, 0x5f, 0x23, 0x92, 0x36, 0x1d, 0x6d, 0xf1, 0x17, 0x2d, 0x2a, 0xc6, 0x25, 0x86,
+    0x2e, 0x8d, 0x4b, 0xa8, 0x30, 0x0d, 0x4d, 0x55, 0xe7, 0x82, 0x2c, 0xdc, 0x35, 0x14, 0x35, 0x2d,
+    0x33, 0x0a, 0xdd, 0xd9, 0x68, 0x61, 0xc7, 0x91, 0x8a, 0x6e, 0x72, 0x58, 0xb6, 0xff, 0x1c, 0xc9,
+    0x29, 0xe3, 0xb8, 0x20, 0x62, 0xa1, 0xb7, 0x36, 0xce, 0xf7, 0x86, 0x29, 0x9f, 0xe5, 0x29, 0x74,
+    0x5b, 0x7f, 0xf0, 0x09, 0x10, 0x68, 0x5d, 0x67, 0xf4, 0x58, 0x11, 0xb2, 0xa6, 0x57, 0x24, 0xa9,
+    0xcc, 0x87, 0xb9, 0xa1, 0x19, 0xcc, 0x4e, 0x43, 0x8b, 0x6c, 0xbd, 0x41, 0xac, 0x35, 0x2b, 0xcf,
+    0x34, 0x38, 0x55, 0xe4, 0x81, 0xca, 0x40, 0x70, 0x86, 0xa1, 0x9c, 0x0a, 0xf9, 0x07, 0x55, 0x3d,
+    0x25, 0x8a, 0x2f, 0x15, 0x7a, 0x67, 0x84, 0xb2, 0xef, 0x2b, 0x6d, 0xbb, 0x37, 0x01, 0xdc, 0x58,
+    0x38, 0xd1, 0x79, 0x2a, 0x33, 0x18, 0x80, 0x0c, 0x52, 0x99, 0xa6, 0x0b, 0x35, 0x34, 0x3a, 0x4f,
+    0x0f, 0x56, 0xdf, 0x1d, 0x1c, 0x19, 0xe6, 0x58, 0x48, 0x55, 0x07, 0x39, 0x10, 0xdb, 0x48, 0x49,
+    0x97, 0x29, 0x6a, 0xa1, 0xa4, 0x05, 0x69, 0x66, 0x39, 0xa1, 0x5b, 0x00, 0x35, 0xdc, 0x58, 0x61,
+    0x81, 0x20, 0x26, 0x07, 0x92, 0xd6, 0x30, 0xbe, 0x69, 0x7c, 0xd5, 0x0b, 0x12, 0xf2, 0x94, 0x93,
+    0x9e, 0x9f, 0xfb, 0xc7, 0xda, 0xf3, 0xcf, 0xc2, 0xaf, 0x11, 0x1f, 0x4f, 0x5a, 0xd3, 0x18, 0xe8,
+    0xca, 0xfb, 0xb3, 0x11, 0x68, 0x14, 0x41, 0x75, 0x4c, 0xd0, 0x07, 0xd0, 0x59, 0xe9, 0xdf, 0xb5,
+    0x73, 0xb7, 0xd4, 0x4e, 0x18, 0x74, 0xec, 0x3a, 0x1f, 0x00, 0x1e, 0xcc, 0x11, 0x6a, 0xc7, 0x5f,
+    0x6a, 0x3f, 0x2e, 0xc0, 0x6d, 0x69, 0x53, 0xf0, 0x07, 0x64, 0x63, 0x44, 0x23, 0xde, 0xd0, 0x81,
+    0xbe, 0xde, 0x20, 0x27, 0x83, 0x41, 0x87, 0x59, 0x4e, 0x32, 0xa9, 0xd5, 0xb5, 0xeb, 0x94, 0xe4,
+    0x1f, 0x8e, 0x5e, 0xe7, 0xeb, 0xc9, 0xe3, 0xcf, 0x9f, 0x9e, 0xed, 0xe6, 0xf9, 0x22, 0xb0, 0xf0,
+    0x27, 0x63, 0xd9, 0x59, 0x7d, 0x78, 0x60, 0x2f, 0xd6, 0x7c, 0x68, 0xa8, 0xa7, 0x5d, 0xc3, 0x76,
+    0x6d, 0x80, 0x99, 0xca, 0x15, 0x2d, 0x58, 0x0d, 0xf4, 0x53, 0x33, 0xd3, 0xeb, 0x81, 0x4a, 0xf2,
+    0xd1, 0xd0, 0xf4, 0x0e, 0xa9, 0x68, 0x74, 0xac, 0xd9, 0xe7, 0x2b, 0x63, 0xd3, 0x38, 0x19, 0x37,
+    0x1a, 0xda, 0xce, 0xb3, 0x3f, 0x1f, 0x74, 0x2e, 0xaa, 0x20, 0xc1, 0x71, 0x9c, 0x93, 0xe1, 0x40,
+    0xd2, 0x5f, 0x1e, 0x9f, 0x1c, 0xf5, 0xdb, 0xc7, 0x0a, 0x1a, 0xd3, 0x74, 0x3c, 0x2a, 0x58, 0x8a,
+    0x73, 0xa4, 0x22, 0x01, 0x45, 0x72, 0xe9, 0x81, 0x19, 0x7d, 0x23, 0x69, 0x24, 0x59, 0x15, 0xaa,
+    0x5e, 0x05, 0x99, 0xe1, 0x44, 0x83, 0x60, 0x1c, 0x0c, 0x40, 0xfa, 0xfd, 0x20, 0x49, 0x34, 0x0c,
+    0xae, 0x73, 0xbf, 0xda, 0x6d, 0x57, 0x5b, 0xdf, 0x80, 0xa0, 0x1e, 0xa7, 0x9c, 0x55, 0x28, 0xa3,
+    0x39, 0x00, 0x08, 0x6d, 0xb7, 0xe6, 0xb7, 0x90, 0xd8, 0xcb, 0x51, 0x2b, 0x9a, 0x14, 0x66, 0x57,
+    0x7e, 0x33, 0x15, 0xf9, 0x1b, 0xd1, 0x32, 0x55, 0x93, 0xb3, 0xe2, 0x16, 0x6d, 0x7d, 0x63, 0xe5,
+    0xff, 0xe5, 0x76, 0xe7, 0x4f, 0xea, 0x45, 0x8b, 0x8c, 0x27, 0x81, 0xff, 0x7d, 0x70, 0xf5, 0xbb,
+    0xd3, 0xd9, 0x30, 0x1d, 0xb6, 0x46, 0x01, 0xd7, 0xc1, 0xbe, 0x73, 0x6c, 0x0a, 0x70, 0x97, 0x9d,
+    0x25, 0x8b, 0xc3, 0x5d, 0x63, 0x51, 0x90, 0x6f, 0x55, 0xbd, 0x15, 0x44, 0x03, 0x3f, 0x2d, 0xab,
+    0x5a, 0x22, 0xe5, 0x42, 0x35, 0xb7, 0x7f, 0x60, 0x95, 0x8a, 0x45, 0x7f, 0x98, 0x19, 0xd9, 0x46,
+    0xf3, 0x4c, 0xf4, 0xa9, 0x01, 0x6e, 0x66, 0x04, 0x33, 0x1a, 0xb5, 0x1d, 0xab, 0xee, 0x83, 0x20,
+    0x39, 0xb4, 0xdf, 0xd9, 0x1a, 0xbc, 0xf0, 0x50, 0xe8, 0x0d, 0x7a, 0xcc, 0xc3, 0xd3, 0xfd, 0xd3,
+    0xce, 0x26, 0x28, 0x6f, 0x5a, 0x64, 0x57, 0x2e, 0xe5, 0x56, 0x18, 0x7f, 0x3e, 0x3f, 0xf4, 0xf8,
+    0x5c, 0xbf, 0x65, 0x5d, 0xee, 0xeb, 0x48, 0x25, 0xab, 0xa7, 0x8b, 0x0c, 0xaa, 0x02, 0xfa, 0x46,
+    0x99, 0x90, 0x71, 0x6a, 0x3c, 0x3d, 0x3f, 0x81, 0x85, 0xd1, 0x95, 0x06, 0xa6, 0x36, 0x09, 0x0c,
+    0x35, 0x39, 0x69, 0x41, 0x73, 0xb4, 0x62, 0xd6, 0x9b, 0xf4, 0xeb, 0x2e, 0x72, 0xc3, 0x6e, 0xf4,
+    0x0e, 0xeb, 0xcc, 0xdf, 0xce, 0x6c, 0x8e, 0xd4, 0x37, 0xa2, 0x4f, 0xbb, 0x6d, 0x68, 0x5b, 0xef,
+    0x49, 0x0e, 0x8c, 0x26, 0xe4, 0xab, 0x36, 0x79, 0x57, 0x67, 0x6d, 0x3d, 0x7a, 0xbe, 0x47, 0x82,
+    0xdb, 0xee, 0x5b, 0x0e, 0xab, 0x2b, 0xaa, 0x8b, 0xc5, 0xc0, 0xa0, 0xb5, 0x5d, 0xa5, 0x8f, 0x8f,
+    0xc1, 0xf9, 0x08, 0xf3, 0xa5, 0xd4, 0x78, 0x7d, 0x61, 0xad, 0x57, 0xdf, 0x70, 0x8d, 0x57, 0x1c,
+    0x9a, 0xe9, 0xbc, 0xdc, 0xfe, 0x0f, 0x2d, 0x51, 0x28, 0x73, 0x41, 0x13, 0x00, 0x00,
+};
+static const WebAsset WEB_HOME_CSS = {"/home.c825a557.css", "text/css", WEB_HOME_CSS_GZ, sizeof(WEB_HOME_CSS_GZ), "\"c825a557077c70ca\"", true};
+
+// home.js: 13043 bytes, 10004 minified, 3280 gzipped
+static const uint8_t WEB_HOME_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x5a, 0xcd, 0x6e, 0x1b, 0xc9,
+    0x11, 0xbe, 0xf3, 0x29, 0xda, 0x84, 0xb1, 0x33, 0x93, 0xe5, 0x8f, 0x76, 0x1d, 0x01, 0xbb, 0xa4,
+    0x28, 0x41, 0x92, 0xe9, 0x78, 0x03, 0xc9, 0x12, 0x44, 0x7a, 0x1d, 0xc0, 0xeb, 0x48, 0xcd, 0x99,
+    0xa6, 0x38, 0xab, 0xe1, 0x34, 0x33, 0x33, 0x24, 0x25, 0xc8, 0x3c, 0x27, 0x39, 0xe4, 0x12, 0x60,
+    0x81, 0x1c, 0x92, 0x43, 0x80, 0xec, 0x31, 0x59, 0x04, 0x08, 0xb0, 0xa7, 0x20, 0x40, 0x5e, 0x20,
+    0xef, 0x10, 0x64, 0x01, 0xe7, 0x94, 0x57, 0x48, 0x55, 0x75, 0xf7, 0xfc, 0x71, 0x28, 0xc9, 0xd9,
+    0x4b, 0x60, 0x40, 0xe4, 0x4c, 0x57, 0x57, 0x55, 0xd7, 0xcf, 0x57, 0x55, 0x4d, 0x07, 0x22, 0x61,
+    0x9e, 0x58, 0xf8, 0xae, 0x78, 0xca, 0x13, 0xce, 0x7a, 0xec, 0xb6, 0x36, 0x96, 0xd2, 0x3b, 0x90,
+    0xcb, 0xa0, 0xc3, 0xb6, 0x1a, 0xb5, 0x25, 0x4f, 0x44, 0x94, 0x3e, 0x25, 0xfe, 0x54, 0xbc, 0xe2,
+    0x51, 0xd8, 0x61, 0x63, 0x1e, 0xc4, 0xa2, 0x51, 0xe3, 0x01, 0x8f, 0xa6, 0xb4, 0x14, 0xbb, 0x13,
+    0xe1, 0xcd, 0x03, 0xd1, 0x61, 0xaf, 0xdf, 0xd4, 0x56, 0xdd, 0x9a, 0x2b, 0xc3, 0x38, 0x61, 0xfb,
+    0x47, 0xfb, 0x67, 0xc7, 0xe7, 0xcf, 0x4e, 0x4e, 0x9e, 0x9e, 0x0f, 0xfa, 0x2f, 0x06, 0x27, 0x67,
+    0x20, 0x61, 0xeb, 0x7a, 0xeb, 0xe3, 0xe2, 0xfa, 0xab, 0xfd, 0x61, 0xff, 0xac, 0x40, 0xf0, 0x43,
+    0x43, 0x40, 0x5b, 0x8f, 0x4e, 0x5e, 0x9d, 0x1f, 0xec, 0x3f, 0xfd, 0x51, 0x1f, 0x16, 0xb7, 0xb7,
+    0xcc, 0x92, 0xda, 0x05, 0x6b, 0xf0, 0xf6, 0x93, 0xf4, 0xed, 0xf1, 0xfe, 0x4f, 0xce, 0x07, 0x87,
+    0xcf, 0xfb, 0x4f, 0x5f, 0x1e, 0xf5, 0x07, 0xb8, 0x92, 0x8a, 0x3a, 0x3e, 0x79, 0xf9, 0x62, 0x78,
+    0x7e, 0xb4, 0x7f, 0xd0, 0x3f, 0xc2, 0x73, 0xb2, 0xa3, 0x0e, 0xab, 0x1f, 0xb1, 0xbf, 0x7f, 0xcb,
+    0x06, 0x53, 0x1e, 0x04, 0xf5, 0x06, 0x3b, 0x86, 0x17, 0xc7, 0xf8, 0xe2, 0xd8, 0xf7, 0xe0, 0xf1,
+    0x39, 0x3c, 0x3e, 0xc7, 0xc7, 0xe7, 0xfe, 0xe5, 0xa4, 0xce, 0xe0, 0x4c, 0xe3, 0x79, 0xe8, 0x26,
+    0xbe, 0x0c, 0x59, 0xc0, 0x47, 0x22, 0x78, 0x26, 0xa3, 0xfd, 0xa9, 0x9c, 0x87, 0x89, 0xed, 0x4a,
+    0x4f, 0x38, 0x60, 0x39, 0x25, 0xc8, 0x05, 0xee, 0xf4, 0x8a, 0xbd, 0x7d, 0xcb, 0xea, 0x75, 0xa7,
+    0x95, 0xc8, 0x97, 0xb3, 0x99, 0x88, 0x0e, 0x79, 0x2c, 0x6c, 0xa7, 0x5b, 0x8b, 0x44, 0x32, 0x8f,
+    0xc2, 0x82, 0x3e, 0xaf, 0xdd, 0x37, 0x48, 0xec, 0xd2, 0x8e, 0x66, 0xb3, 0xde, 0xad, 0xad, 0x32,
+    0x61, 0xf3, 0x99, 0x07, 0x4e, 0x18, 0x24, 0x3c, 0x99, 0xc7, 0x76, 0x26, 0x06, 0xdd, 0xf4, 0x39,
+    0x0f, 0x40, 0xd8, 0x31, 0x4f, 0x26, 0xad, 0xa9, 0x1f, 0xda, 0x9f, 0x7e, 0xfa, 0x69, 0x43, 0x3f,
+    0xf1, 0x6b, 0x7b, 0xab, 0x91, 0xf3, 0x6c, 0xcb, 0x78, 0xd5, 0x01, 0x0d, 0x3c, 0xe9, 0xce, 0xa7,
+    0x22, 0x4c, 0x5a, 0x97, 0x22, 0xe9, 0x07, 0x02, 0xbf, 0x1e, 0xdc, 0x7c, 0xe6, 0xd9, 0xd6, 0x82,
+    0x07, 0x4d, 0x24, 0x6c, 0x8e, 0x80, 0xd2, 0x02, 0xcd, 0xc5, 0x75, 0x72, 0x28, 0xc3, 0x04, 0x08,
+    0x40, 0x8e, 0x91, 0xf8, 0x21, 0xab, 0x5f, 0xd6, 0x8d, 0x59, 0x03, 0xb9, 0x3c, 0x9c, 0xf8, 0x33,
+    0x58, 0xde, 0xc8, 0x95, 0x38, 0x02, 0x5d, 0xd3, 0x05, 0x42, 0x0b, 0xe4, 0xeb, 0x3d, 0xad, 0x38,
+    0xb9, 0x09, 0x44, 0xcb, 0xf3, 0xe3, 0x59, 0xc0, 0x6f, 0xd0, 0x6a, 0x46, 0xc2, 0x4e, 0xc9, 0xef,
+    0x0e, 0xdb, 0x63, 0x96, 0x1f, 0x06, 0x7e, 0x28, 0x9a, 0xe3, 0x40, 0x5c, 0x5b, 0xac, 0xc3, 0xac,
+    0x50, 0x86, 0xc2, 0x32, 0x6a, 0x2c, 0x47, 0xfd, 0xe0, 0x2e, 0x1d, 0xf0, 0x64, 0x14, 0xcb, 0xfa,
+    0x68, 0xe9, 0x3e, 0x7c, 0xf7, 0x1e, 0x66, 0x4c, 0xf3, 0x01, 0xed, 0x88, 0x42, 0x4b, 0x36, 0x4a,
+    0xf9, 0x69, 0x23, 0xf9, 0x63, 0x3b, 0x7d, 0xb5, 0x93, 0x85, 0x2c, 0xba, 0x91, 0x76, 0xbb, 0x01,
+    0x8f, 0xe3, 0x23, 0x3f, 0x4e, 0x5a, 0xdc, 0x03, 0x35, 0xfd, 0xb8, 0xc9, 0x03, 0x11, 0x25, 0x96,
+    0xe1, 0x9e, 0xad, 0x47, 0x62, 0x2a, 0x17, 0x82, 0x48, 0xe4, 0x15, 0xae, 0xaf, 0x98, 0x80, 0x1c,
+    0xdc, 0xcc, 0x48, 0x51, 0x6d, 0xe6, 0x92, 0x0a, 0x5a, 0x69, 0x5b, 0xd0, 0x8b, 0x18, 0x0e, 0xf1,
+    0xfa, 0x0d, 0x2a, 0xce, 0x36, 0x68, 0xae, 0xc8, 0x5a, 0xb3, 0x79, 0x3c, 0xb1, 0xeb, 0xaf, 0x90,
+    0x84, 0xa1, 0x4d, 0x99, 0x1f, 0x33, 0x58, 0xaf, 0x3b, 0x6a, 0x6f, 0xce, 0x66, 0x06, 0x35, 0x4a,
+    0x5b, 0x0f, 0x03, 0xe9, 0x5e, 0xb1, 0x50, 0x26, 0x2c, 0xbe, 0x09, 0x5d, 0xe1, 0x55, 0xec, 0x24,
+    0x78, 0x61, 0x1f, 0xac, 0xc3, 0x48, 0x89, 0xd5, 0x33, 0x88, 0x1b, 0x16, 0xbb, 0xf0, 0x8e, 0xf8,
+    0x45, 0x22, 0x9e, 0xc9, 0xd0, 0xf3, 0xc3, 0xcb, 0x7b, 0x79, 0xe6, 0xa1, 0xa7, 0xf2, 0x68, 0x9b,
+    0xb8, 0x2a, 0x93, 0x8d, 0x78, 0x18, 0x02, 0xd1, 0x1d, 0x81, 0x47, 0x2c, 0x9b, 0x8a, 0xce, 0xd2,
+    0xda, 0x68, 0x31, 0x81, 0x08, 0x2f, 0x93, 0x09, 0x86, 0x82, 0x5a, 0x5e, 0xcb, 0x07, 0x6b, 0x84,
+    0x26, 0x82, 0x18, 0xd7, 0xeb, 0xc5, 0x50, 0xd3, 0x5c, 0xbe, 0x94, 0x10, 0xb2, 0x75, 0xc4, 0xa9,
+    0x7a, 0x3e, 0x28, 0x36, 0xb1, 0xd4, 0x59, 0x53, 0xc9, 0xb1, 0x4e, 0xc0, 0x93, 0x83, 0x9e, 0x48,
+    0x84, 0x9e, 0x88, 0x06, 0x1a, 0xda, 0x73, 0xe0, 0x03, 0x7f, 0x13, 0xee, 0xdf, 0x73, 0x74, 0x53,
+    0x12, 0x9a, 0x29, 0x75, 0x96, 0x77, 0xa3, 0x24, 0xbc, 0xd3, 0x6a, 0x9e, 0x77, 0x90, 0x84, 0x19,
+    0xb9, 0x8b, 0x38, 0x7b, 0x84, 0xa8, 0xfb, 0x40, 0x81, 0x40, 0xae, 0x77, 0x2b, 0xc9, 0x2d, 0x1f,
+    0xcf, 0xfb, 0x7c, 0x78, 0x8c, 0xd8, 0x6f, 0x81, 0x01, 0x72, 0x11, 0x61, 0xb6, 0xb5, 0x62, 0x19,
+    0x25, 0xb6, 0xcd, 0x1b, 0x6c, 0xe4, 0xb0, 0xde, 0x2e, 0x53, 0x91, 0xdb, 0x02, 0x1f, 0x80, 0xa9,
+    0x0f, 0xe5, 0x74, 0xc6, 0x23, 0x61, 0x8f, 0xe8, 0x25, 0xa1, 0x68, 0x05, 0x87, 0xb1, 0x8c, 0xfa,
+    0xdc, 0x9d, 0xd8, 0xb6, 0x9f, 0x88, 0x69, 0x83, 0xf9, 0x60, 0xbe, 0x6b, 0xe2, 0x65, 0x0c, 0xe7,
+    0xf9, 0x8b, 0xfc, 0x09, 0xdc, 0x48, 0x40, 0x94, 0xe9, 0x43, 0xd8, 0x16, 0xac, 0xa2, 0xd6, 0xf0,
+    0xa1, 0x52, 0xf6, 0x05, 0x9f, 0x0a, 0xd4, 0x37, 0x3d, 0x18, 0xb2, 0xb5, 0x14, 0x41, 0xfe, 0x40,
+    0x17, 0xb5, 0x1d, 0x64, 0x4c, 0xce, 0xee, 0xd5, 0xb5, 0xb7, 0x3b, 0x88, 0x94, 0x5d, 0x08, 0x13,
+    0xff, 0x32, 0xa4, 0x8d, 0x71, 0xc7, 0x05, 0x29, 0x22, 0xaa, 0xef, 0xd6, 0x76, 0xe2, 0x19, 0x0f,
+    0x19, 0xc9, 0xe8, 0xd5, 0x81, 0x7b, 0x13, 0x0f, 0x55, 0xdf, 0x7d, 0x7c, 0x8b, 0x74, 0x74, 0xc2,
+    0xd5, 0x4e, 0x1b, 0x69, 0x2a, 0x48, 0x39, 0x15, 0x3d, 0x24, 0x2e, 0x95, 0x41, 0xda, 0xab, 0x56,
+    0x9d, 0x6c, 0x7b, 0x1b, 0x34, 0x83, 0x8f, 0xd1, 0x3c, 0x49, 0x64, 0xca, 0xc7, 0x13, 0x41, 0x13,
+    0x42, 0xa0, 0xce, 0x64, 0xe8, 0x06, 0xbe, 0x7b, 0x45, 0x6f, 0x04, 0x54, 0x39, 0x13, 0x6a, 0xa0,
+    0x09, 0xda, 0x6e, 0xe5, 0xd4, 0x77, 0xff, 0xf9, 0xdb, 0xaf, 0x76, 0xda, 0x6a, 0xfb, 0x6e, 0xed,
+    0x22, 0xef, 0x53, 0x0e, 0x65, 0x35, 0xf4, 0xa0, 0x94, 0x04, 0x9e, 0x0d, 0x52, 0x30, 0xfc, 0xc9,
+    0xe7, 0x26, 0x56, 0x4a, 0xe1, 0x7d, 0xf1, 0xf8, 0xb6, 0xca, 0x67, 0x2a, 0x0d, 0x57, 0xed, 0xc7,
+    0xb7, 0x85, 0xde, 0x61, 0x75, 0x41, 0xe8, 0xbd, 0x79, 0x07, 0xdb, 0xed, 0x15, 0xbb, 0x0d, 0xca,
+    0xe4, 0x24, 0xc4, 0x6c, 0xe3, 0xa3, 0x40, 0x78, 0x20, 0x32, 0x89, 0xe6, 0xa2, 0x4b, 0x2f, 0x4b,
+    0x99, 0x76, 0xcc, 0xaf, 0xd9, 0x27, 0xec, 0x4c, 0x70, 0xe4, 0x59, 0xcf, 0xe7, 0x6d, 0x91, 0x01,
+    0xf5, 0x59, 0x95, 0x1c, 0x3e, 0x64, 0xfb, 0x9e, 0xc7, 0x8c, 0xc1, 0xca, 0x99, 0x2b, 0xc1, 0x32,
+    0x03, 0x91, 0x24, 0x80, 0x56, 0xaa, 0x69, 0x58, 0x82, 0x3d, 0xe5, 0x92, 0x82, 0x19, 0x09, 0x5a,
+    0x93, 0x48, 0x8c, 0x91, 0x4d, 0x7b, 0xe9, 0x8f, 0xfd, 0x7a, 0x56, 0x04, 0xc6, 0x42, 0x78, 0xc7,
+    0xd2, 0xe3, 0x77, 0x26, 0x1a, 0x12, 0x9d, 0x2c, 0x44, 0x04, 0x51, 0x86, 0xf1, 0x5a, 0x90, 0xfa,
+    0xcc, 0x30, 0x20, 0xb1, 0x29, 0xbb, 0x75, 0x24, 0xa2, 0x42, 0x5e, 0xe8, 0x74, 0xdc, 0x40, 0xc6,
+    0xe2, 0xc1, 0xfb, 0x35, 0x92, 0xad, 0x6a, 0x1c, 0xeb, 0x07, 0x4b, 0xb9, 0xc4, 0x10, 0x13, 0xc8,
+    0xc4, 0x0e, 0xc4, 0x42, 0x04, 0x84, 0x59, 0x25, 0xbe, 0x0f, 0x04, 0x21, 0x94, 0x5d, 0x40, 0xa1,
+    0x59, 0x24, 0x16, 0x43, 0xf0, 0x02, 0x6c, 0x2a, 0x39, 0xa4, 0xca, 0x43, 0x17, 0x28, 0x11, 0xec,
+    0xcf, 0x20, 0x51, 0x50, 0x93, 0x55, 0xab, 0xd5, 0xba, 0xe8, 0x56, 0x47, 0x48, 0x12, 0xdd, 0xa4,
+    0x10, 0x31, 0x92, 0x1e, 0x9e, 0x2f, 0x14, 0x4b, 0xf6, 0xf2, 0xec, 0x68, 0x20, 0x78, 0xe4, 0x4e,
+    0x4e, 0x79, 0xc4, 0xa7, 0x31, 0x6a, 0x8e, 0xab, 0x3a, 0xf0, 0x6d, 0x8b, 0xf8, 0x5a, 0x0d, 0xa6,
+    0x4e, 0x6a, 0xd4, 0x84, 0x42, 0x85, 0xe5, 0x61, 0xc9, 0x7d, 0x74, 0x67, 0x02, 0x70, 0x64, 0xb5,
+    0xf9, 0xcc, 0x6f, 0xe3, 0x79, 0xce, 0x43, 0xb9, 0x84, 0x0d, 0xb7, 0xb5, 0xa9, 0x48, 0x26, 0xd2,
+    0x83, 0x36, 0xea, 0xf4, 0x64, 0x30, 0xb4, 0x1a, 0xb5, 0x89, 0xe0, 0x00, 0xf5, 0x71, 0x07, 0x1a,
+    0x63, 0x4b, 0x9f, 0xa1, 0x39, 0xbc, 0x99, 0x09, 0x0b, 0x48, 0x40, 0x1c, 0x24, 0x29, 0xc5, 0x4d,
+    0xfb, 0xba, 0xb9, 0x5c, 0x2e, 0xa1, 0x49, 0x8c, 0xa6, 0xcd, 0x79, 0x04, 0x89, 0x80, 0x8d, 0xae,
+    0x67, 0xb1, 0x55, 0x83, 0x34, 0xeb, 0x90, 0xf6, 0xd0, 0xf1, 0x0e, 0x92, 0x08, 0x8e, 0x6e, 0x3b,
+    0x94, 0x91, 0x58, 0xf3, 0x1e, 0x81, 0x56, 0x2d, 0x79, 0x85, 0xee, 0x48, 0x26, 0x91, 0x5c, 0xd2,
+    0xf9, 0xfa, 0x51, 0x24, 0x23, 0x5b, 0x69, 0x8a, 0xeb, 0x68, 0x40, 0xdb, 0xa1, 0x96, 0xa4, 0xd2,
+    0x9e, 0x1e, 0xb3, 0x8d, 0x31, 0x1d, 0x30, 0x65, 0x2c, 0x92, 0x21, 0x40, 0x95, 0x9c, 0x03, 0x6a,
+    0x3b, 0xbd, 0xdd, 0xdb, 0x8a, 0x4d, 0x16, 0x3a, 0x81, 0xbd, 0x80, 0x43, 0x77, 0x37, 0xa4, 0xd6,
+    0xaa, 0xc1, 0x3e, 0xda, 0xde, 0xda, 0xa2, 0xda, 0x09, 0x67, 0x74, 0x27, 0xcc, 0xa6, 0x66, 0x9e,
+    0xca, 0xab, 0xad, 0xf6, 0x8f, 0xb9, 0x0f, 0x7b, 0xc0, 0x12, 0xd0, 0xd6, 0x89, 0xd6, 0x54, 0xc4,
+    0x31, 0xbf, 0x14, 0x4e, 0x95, 0xd3, 0x4d, 0x88, 0x6c, 0x94, 0x86, 0xf1, 0x9e, 0xc6, 0x34, 0x94,
+    0xb9, 0xfe, 0x02, 0x36, 0x62, 0x6b, 0x26, 0x00, 0xd1, 0x6c, 0x8b, 0xd0, 0x10, 0x1c, 0x04, 0x3a,
+    0xe0, 0x81, 0xd0, 0x72, 0xa2, 0x95, 0xf0, 0x08, 0x62, 0x93, 0xf5, 0x7a, 0xbd, 0x2c, 0x3d, 0x1d,
+    0xb6, 0x1e, 0xd5, 0xab, 0xac, 0x5e, 0x06, 0x90, 0x1c, 0x06, 0x1b, 0xb0, 0xb3, 0xa6, 0x22, 0x54,
+    0x85, 0x65, 0x53, 0x3e, 0x23, 0xe0, 0xc6, 0x75, 0xfb, 0x96, 0x21, 0xf4, 0x77, 0x58, 0x5a, 0x05,
+    0x1a, 0x4c, 0xe1, 0xb9, 0x7e, 0xa5, 0x1e, 0xd8, 0xca, 0x49, 0x05, 0x01, 0x6c, 0xab, 0xd6, 0x7d,
+    0x1a, 0x93, 0x08, 0xf4, 0xea, 0x69, 0x24, 0xa7, 0x3e, 0xcc, 0x3a, 0xe0, 0x51, 0x19, 0x2c, 0x04,
+    0xbe, 0xce, 0x79, 0x4a, 0xbf, 0x6d, 0x30, 0xd8, 0x91, 0xc7, 0x8e, 0x78, 0x22, 0x97, 0x47, 0x92,
+    0x63, 0xc6, 0xd8, 0x89, 0x4a, 0x32, 0x6b, 0xc0, 0x17, 0xf0, 0x08, 0x79, 0x63, 0xa1, 0x47, 0x36,
+    0x26, 0x6a, 0xa0, 0xb6, 0xa1, 0xdd, 0xd7, 0x86, 0x96, 0x84, 0x9c, 0x71, 0xdf, 0xd6, 0x14, 0xcc,
+    0x1e, 0x02, 0x53, 0x13, 0xdf, 0x13, 0x46, 0xd3, 0x87, 0xe8, 0x75, 0x07, 0xf3, 0x4d, 0x18, 0x56,
+    0xaa, 0x86, 0xba, 0x8f, 0xc0, 0x78, 0x80, 0xc9, 0x32, 0x1c, 0xfb, 0xd1, 0xd4, 0xae, 0x9f, 0x51,
+    0x2b, 0xcf, 0x92, 0x09, 0x34, 0xde, 0x63, 0x0d, 0x35, 0xe8, 0xb3, 0xbd, 0xba, 0x83, 0xa4, 0x79,
+    0x7b, 0x5a, 0x4f, 0x91, 0x9f, 0x31, 0x65, 0x1e, 0xce, 0x40, 0x89, 0x42, 0xac, 0xd8, 0x1b, 0x1a,
+    0x9b, 0x18, 0x11, 0x40, 0x2b, 0x02, 0x09, 0x43, 0x63, 0x6c, 0xb1, 0x37, 0x34, 0x5c, 0xe5, 0x55,
+    0x0a, 0x3e, 0x88, 0xc4, 0xc8, 0x66, 0x28, 0xfb, 0x83, 0x53, 0xa0, 0x60, 0xed, 0x36, 0x1b, 0xc0,
+    0x39, 0x6b, 0x05, 0x0b, 0x6a, 0x7c, 0x50, 0xd8, 0x50, 0x21, 0x5b, 0x67, 0x55, 0x95, 0xc4, 0x15,
+    0xfd, 0x53, 0x72, 0xa7, 0xf7, 0x15, 0x2d, 0x22, 0xd8, 0x54, 0xb5, 0xb2, 0x8a, 0xf3, 0xbe, 0x35,
+    0x5f, 0x8d, 0xf3, 0xe6, 0xf4, 0x00, 0xaf, 0x1a, 0xbb, 0x61, 0x7b, 0xce, 0x2a, 0xe8, 0x18, 0xc0,
+    0x44, 0x5c, 0x83, 0x2a, 0x9c, 0xc8, 0xa1, 0x7a, 0x26, 0x03, 0xb4, 0xe2, 0xf9, 0x28, 0x56, 0xdf,
+    0xb7, 0x1a, 0xdb, 0x77, 0xcd, 0xe7, 0x7e, 0x38, 0x9b, 0x53, 0x22, 0x41, 0x2c, 0xc1, 0x44, 0x3b,
+    0x47, 0xdb, 0x68, 0xce, 0xdd, 0xda, 0xf4, 0xbd, 0xca, 0x6c, 0x76, 0xe0, 0xe9, 0x7b, 0x96, 0x57,
+    0xbe, 0x10, 0x15, 0x13, 0x01, 0xaa, 0x71, 0x97, 0xf5, 0xd7, 0x54, 0x37, 0x96, 0xd1, 0x98, 0x72,
+    0xdf, 0x56, 0xd5, 0x63, 0x9a, 0xcd, 0xe5, 0x3b, 0x15, 0x70, 0xda, 0x23, 0xea, 0xcb, 0x4b, 0xee,
+    0x10, 0xd7, 0x80, 0xac, 0x58, 0x0d, 0xab, 0xdb, 0xfd, 0xa9, 0x48, 0xb1, 0x2f, 0x85, 0x3c, 0x82,
+    0x59, 0xe2, 0xa5, 0x02, 0x53, 0xb1, 0xc8, 0x2a, 0x42, 0x7d, 0x88, 0x09, 0x47, 0x94, 0xf0, 0xc9,
+    0x03, 0xe8, 0xe0, 0xa1, 0x5e, 0x1b, 0xa6, 0xde, 0x23, 0xf6, 0x45, 0x78, 0x1a, 0x08, 0xd0, 0x8b,
+    0xb9, 0x13, 0x09, 0x86, 0x66, 0x1c, 0x9a, 0xfe, 0xf1, 0x58, 0x44, 0x88, 0x47, 0x34, 0x50, 0x30,
+    0xbb, 0xf7, 0xd3, 0xff, 0xfc, 0xf5, 0xeb, 0x7f, 0xfc, 0x12, 0xfe, 0xfc, 0xb4, 0xe7, 0xd4, 0xd3,
+    0x3b, 0x21, 0xea, 0xc2, 0x72, 0xce, 0xe9, 0x16, 0x93, 0x58, 0xa1, 0x61, 0x2a, 0xea, 0x7f, 0xce,
+    0x65, 0x1a, 0x6f, 0x15, 0xd4, 0x1b, 0x7c, 0x67, 0xab, 0xff, 0xa3, 0x8c, 0x2e, 0x05, 0x1c, 0xa2,
+    0xe8, 0xda, 0xed, 0xd7, 0xa6, 0x1e, 0x27, 0x26, 0x42, 0xb4, 0x0b, 0x36, 0x2d, 0x37, 0x7a, 0x5f,
+    0xd6, 0x61, 0x7c, 0x19, 0xcb, 0x50, 0x77, 0x18, 0xa9, 0x80, 0x3c, 0x25, 0xae, 0x97, 0xb4, 0x36,
+    0x37, 0x67, 0x77, 0x5e, 0x11, 0xe1, 0xbe, 0x8c, 0x72, 0x6f, 0x6f, 0xe3, 0xd5, 0x5b, 0xc5, 0x55,
+    0xd2, 0xfd, 0x8c, 0x33, 0xd2, 0x22, 0xe7, 0xc2, 0x6d, 0x54, 0xc5, 0x8d, 0x0b, 0x70, 0x7e, 0xf4,
+    0x88, 0x38, 0x98, 0x37, 0x05, 0x32, 0x75, 0x15, 0xd2, 0x53, 0x32, 0xd4, 0xc3, 0x5b, 0xb6, 0xd5,
+    0xdd, 0xe0, 0x82, 0xf5, 0x9c, 0xdf, 0xe8, 0x04, 0x4d, 0x9a, 0x85, 0x27, 0x4a, 0x48, 0x49, 0x33,
+    0x3f, 0x18, 0x2f, 0x19, 0xd6, 0xfb, 0x51, 0xc4, 0x6f, 0x5a, 0x7e, 0x4c, 0x9f, 0xda, 0x17, 0x7b,
+    0x6a, 0x73, 0x47, 0x69, 0x49, 0x73, 0x6c, 0x95, 0xfb, 0x0c, 0x8b, 0x00, 0xb2, 0x75, 0x73, 0xd8,
+    0x15, 0x05, 0x28, 0xda, 0x3d, 0x86, 0x9f, 0xa5, 0x46, 0xa8, 0x56, 0x6a, 0x84, 0xd4, 0x5d, 0x6e,
+    0xa3, 0x66, 0xda, 0xa1, 0xfc, 0xb0, 0x8b, 0x6b, 0x96, 0x55, 0xba, 0xe7, 0x85, 0x66, 0xcc, 0x61,
+    0x1d, 0xba, 0x4a, 0xab, 0x36, 0x67, 0xc8, 0x67, 0x90, 0xdd, 0xc9, 0x43, 0xcc, 0xa9, 0x49, 0xad,
+    0x72, 0x2b, 0x5d, 0x6e, 0xa4, 0x2d, 0x43, 0x49, 0x8d, 0x2a, 0x52, 0xa9, 0x74, 0x78, 0xa8, 0x1b,
+    0x72, 0x29, 0x50, 0xf6, 0x0c, 0x19, 0xdf, 0x18, 0xd2, 0xd9, 0x30, 0x75, 0xe5, 0x90, 0x21, 0x3d,
+    0xd4, 0x8c, 0xdf, 0xe0, 0x71, 0x41, 0xea, 0x8f, 0x07, 0x27, 0x2f, 0x5a, 0xaa, 0xce, 0xf9, 0xe3,
+    0x9b, 0xaa, 0x22, 0xeb, 0x14, 0x07, 0xa1, 0x7b, 0xc3, 0xeb, 0xfb, 0xcc, 0x31, 0x78, 0xa0, 0xdc,
+    0xd8, 0xa2, 0xd5, 0x5c, 0x1f, 0x57, 0xd6, 0x6c, 0x7c, 0x26, 0x7e, 0x36, 0x17, 0x38, 0x28, 0xd3,
+    0x4c, 0x60, 0x42, 0x5c, 0x62, 0x8b, 0x20, 0x11, 0xa4, 0x4d, 0xb0, 0xa9, 0x6b, 0x7b, 0x06, 0xc4,
+    0x73, 0xe1, 0x35, 0xd8, 0x4c, 0x06, 0x01, 0xa2, 0x37, 0x4c, 0x4e, 0x4c, 0x79, 0xa5, 0x80, 0xdf,
+    0x90, 0xed, 0xa7, 0x40, 0x31, 0x54, 0x55, 0xf4, 0x09, 0x0c, 0x24, 0x5b, 0x04, 0xae, 0x4f, 0xb6,
+    0xc1, 0xb2, 0x40, 0xe2, 0xc5, 0xc6, 0x9e, 0x40, 0xf5, 0x19, 0xde, 0xe2, 0x2c, 0xa8, 0xdb, 0xd9,
+    0x46, 0x3a, 0x24, 0x84, 0x2f, 0x53, 0x43, 0x03, 0xfc, 0xa3, 0x44, 0xb3, 0xc2, 0x36, 0xa4, 0x05,
+    0x3d, 0x07, 0x7a, 0x79, 0x39, 0x01, 0x95, 0x99, 0x9d, 0xbd, 0x62, 0xcd, 0x1c, 0xed, 0x4e, 0x5e,
+    0x89, 0xcc, 0x81, 0x4a, 0xd9, 0xd4, 0x11, 0x21, 0xf4, 0xd3, 0x43, 0x1e, 0x5f, 0x61, 0xb0, 0x08,
+    0x3b, 0xaf, 0xcd, 0x46, 0x4b, 0x28, 0x0e, 0x1d, 0x70, 0x57, 0x1a, 0x8e, 0x68, 0x62, 0x6d, 0x05,
+    0xc3, 0xbf, 0x87, 0xf7, 0x5c, 0x73, 0xd7, 0x85, 0xe1, 0xca, 0x32, 0xd2, 0x37, 0x5a, 0x75, 0xf0,
+    0xf2, 0xf0, 0xb0, 0x3f, 0x18, 0x10, 0xce, 0x6f, 0x8c, 0x8f, 0x73, 0xc5, 0x7a, 0xcf, 0x85, 0x72,
+    0x1c, 0xf5, 0x3e, 0xca, 0x88, 0x8b, 0x70, 0x56, 0x55, 0x86, 0xf4, 0x6f, 0x34, 0x6a, 0x38, 0xd7,
+    0x77, 0x33, 0x1b, 0x74, 0x36, 0x71, 0x90, 0x1a, 0x4c, 0x44, 0xd1, 0x71, 0x7c, 0x09, 0x06, 0xd3,
+    0xc4, 0x02, 0xe3, 0x86, 0x30, 0xe2, 0x65, 0x78, 0x05, 0x66, 0x0f, 0x19, 0xbd, 0xb1, 0xde, 0x53,
+    0xf5, 0x72, 0x20, 0x2a, 0x31, 0xce, 0x7d, 0xea, 0xcd, 0x22, 0x89, 0x26, 0x85, 0xd0, 0xb3, 0xf2,
+    0x48, 0x83, 0x79, 0x96, 0x6a, 0xa8, 0x1e, 0xdf, 0x12, 0xf6, 0xe7, 0xcd, 0x7e, 0x71, 0x9a, 0x6e,
+    0x86, 0x60, 0xd5, 0xbb, 0x1e, 0xdf, 0xd2, 0xe7, 0xea, 0x22, 0x8d, 0x5d, 0x18, 0x01, 0x67, 0x31,
+    0x0d, 0xb9, 0x54, 0xb8, 0xc6, 0x81, 0x04, 0xf5, 0x36, 0x44, 0x99, 0xc3, 0xda, 0xec, 0xa3, 0x2d,
+    0x1a, 0xb7, 0xf3, 0xbd, 0xcd, 0x05, 0x36, 0x11, 0x5a, 0x8c, 0x5d, 0x94, 0xd3, 0x80, 0x6f, 0x5a,
+    0xc2, 0x2a, 0x76, 0x2e, 0x74, 0x8f, 0xb0, 0x96, 0x96, 0x7a, 0xbc, 0x04, 0x59, 0x0a, 0x58, 0x20,
+    0x98, 0x6f, 0xd8, 0x48, 0x30, 0x39, 0x1e, 0xe3, 0xcf, 0x46, 0xd6, 0xda, 0x7c, 0x6f, 0x0e, 0x2a,
+    0xd4, 0xfe, 0x2c, 0x5a, 0x09, 0xd6, 0xd4, 0xc0, 0x0f, 0x21, 0x8b, 0xa0, 0xa4, 0x1a, 0xbf, 0x8b,
+    0x77, 0x7f, 0xfa, 0xfd, 0x77, 0xbf, 0xf8, 0xf5, 0xbf, 0xfe, 0xf6, 0xbb, 0xef, 0xfe, 0xf8, 0x9b,
+    0xef, 0xfe, 0xf0, 0xe7, 0x77, 0x7f, 0xf9, 0xba, 0x83, 0xba, 0x99, 0xfb, 0x80, 0xd5, 0x17, 0xe1,
+    0xbb, 0x6f, 0xbe, 0xfd, 0xf7, 0xcf, 0x7f, 0xf5, 0xee, 0x9b, 0xaf, 0x4a, 0x2d, 0xde, 0xc5, 0xfb,
+    0x87, 0x5e, 0xee, 0xbe, 0x00, 0x46, 0x37, 0x96, 0x40, 0xca, 0xbd, 0x02, 0x06, 0x74, 0xe3, 0x1e,
+    0xce, 0x83, 0xa0, 0x5b, 0x06, 0xe0, 0x3b, 0x12, 0x93, 0xa9, 0x8b, 0x04, 0xec, 0xfb, 0x06, 0xd2,
+    0xbd, 0x02, 0x76, 0x1f, 0x7c, 0xc0, 0xb2, 0xa7, 0x16, 0xb5, 0xb0, 0xb4, 0x8f, 0x62, 0xe6, 0x95,
+    0x18, 0xe9, 0x85, 0x93, 0xd3, 0xfe, 0x8b, 0x1c, 0x94, 0xc3, 0x0e, 0x72, 0xb3, 0x41, 0x82, 0xca,
+    0x51, 0x3f, 0x3f, 0x10, 0xa0, 0xb2, 0x85, 0x4b, 0x1a, 0x22, 0xa8, 0x38, 0x0c, 0xd3, 0x0c, 0x6c,
+    0x7c, 0x82, 0xb6, 0x12, 0xbc, 0xbe, 0xad, 0xa2, 0xa4, 0x40, 0x6b, 0x7b, 0x9a, 0x03, 0xe5, 0x85,
+    0x61, 0x4b, 0x92, 0x60, 0xd3, 0x1d, 0x6c, 0x3d, 0xe4, 0xd9, 0x4d, 0xd1, 0x5d, 0x9d, 0xc4, 0x0c,
+    0x0b, 0xfa, 0x60, 0xb9, 0x4b, 0x58, 0x75, 0x40, 0xba, 0xdb, 0x28, 0x43, 0xdc, 0xaa, 0x00, 0x8b,
+    0x67, 0xf7, 0x94, 0xa8, 0xf3, 0xac, 0x1f, 0xa5, 0xaa, 0x92, 0xee, 0xaa, 0xae, 0x2d, 0xaa, 0x02,
+    0xc3, 0xe0, 0x20, 0xdc, 0xab, 0x5c, 0x81, 0xd1, 0x6a, 0x66, 0x9b, 0x4d, 0xd9, 0x56, 0xb1, 0xa1,
+    0xde, 0x0f, 0xb5, 0xbd, 0x55, 0x70, 0x64, 0x75, 0x19, 0x33, 0x6f, 0x90, 0x51, 0xd8, 0x26, 0x1a,
+    0x72, 0xbb, 0xb2, 0xa9, 0xa9, 0xc8, 0x0a, 0x5c, 0x67, 0x4e, 0x6e, 0xab, 0x68, 0x53, 0xd7, 0x6c,
+    0x54, 0xa4, 0x59, 0x2e, 0xa0, 0x75, 0x77, 0xde, 0x2d, 0xfd, 0x56, 0x0d, 0x36, 0x57, 0x29, 0x07,
+    0x19, 0x77, 0xcb, 0x4c, 0xc2, 0x2d, 0xa1, 0x0d, 0x4d, 0x8f, 0x8a, 0xd6, 0x35, 0x27, 0xa5, 0x64,
+    0x63, 0xab, 0x5a, 0xea, 0x7c, 0x2a, 0x6c, 0x67, 0x60, 0x48, 0x17, 0xc2, 0x2e, 0x2d, 0xa0, 0x10,
+    0x72, 0xec, 0x09, 0x4c, 0x60, 0x92, 0x6d, 0xc7, 0xf9, 0x3e, 0x30, 0x4e, 0xe4, 0xec, 0xde, 0x83,
+    0xe2, 0x65, 0x30, 0x84, 0x4e, 0x7a, 0xac, 0xfc, 0x62, 0xf9, 0xf8, 0xca, 0x92, 0x15, 0x13, 0x89,
+    0x0c, 0x3f, 0xf7, 0x63, 0x7f, 0x14, 0x88, 0x33, 0x31, 0x86, 0x08, 0x9b, 0x90, 0x28, 0xd5, 0xb9,
+    0xa8, 0xbf, 0x39, 0xd3, 0xa4, 0x6d, 0xde, 0xda, 0xfd, 0x22, 0xd1, 0xe8, 0x04, 0x82, 0xee, 0x3b,
+    0xb0, 0x5f, 0xe7, 0x6d, 0xd9, 0x28, 0x41, 0xc5, 0x1b, 0x72, 0x77, 0xc9, 0xbe, 0x55, 0x03, 0x54,
+    0x25, 0xc8, 0x29, 0x9b, 0x6b, 0xad, 0xc1, 0xdb, 0xa4, 0x76, 0xc1, 0xee, 0x29, 0xd2, 0xe4, 0x50,
+    0xc2, 0x98, 0xc0, 0xbc, 0x3e, 0xe0, 0xee, 0x15, 0xe0, 0x29, 0xbc, 0x47, 0x08, 0x2f, 0x07, 0xd9,
+    0xe9, 0x5c, 0x5b, 0x82, 0x22, 0x5d, 0xff, 0xde, 0x90, 0x62, 0x09, 0x96, 0x97, 0x8c, 0x75, 0x79,
+    0x4e, 0x8f, 0xf1, 0xa7, 0x60, 0x75, 0x6f, 0x92, 0xee, 0xb0, 0x2f, 0x96, 0x71, 0xa7, 0xdd, 0x7e,
+    0x7c, 0x9b, 0xfd, 0x66, 0x21, 0xe3, 0x64, 0xd5, 0x5e, 0xc6, 0x08, 0xa7, 0x05, 0x35, 0x71, 0x3b,
+    0x78, 0x0f, 0xfe, 0xb6, 0x64, 0x88, 0xd7, 0x39, 0xe9, 0x95, 0xe7, 0x6d, 0xad, 0x4a, 0xf1, 0xb5,
+    0x50, 0xe9, 0xe2, 0x7f, 0x59, 0xd1, 0xfb, 0x35, 0x9c, 0x23, 0x0b, 0xb1, 0xd0, 0x4c, 0x54, 0xc4,
+    0x4f, 0x78, 0xe8, 0x05, 0x82, 0xce, 0x49, 0xcd, 0xec, 0x8c, 0x47, 0x80, 0x7d, 0x62, 0xd1, 0x02,
+    0xa7, 0x70, 0x27, 0x0b, 0x77, 0x65, 0xfc, 0x52, 0xc0, 0x1f, 0x40, 0x13, 0x8c, 0xba, 0x30, 0xcd,
+    0x3f, 0x0b, 0xf7, 0x54, 0x32, 0xcd, 0xfe, 0x25, 0xd5, 0x4b, 0xae, 0xa0, 0x1f, 0xb3, 0xcd, 0x45,
+    0xc9, 0x02, 0xfd, 0xe9, 0x07, 0x7e, 0xa2, 0xc1, 0xfb, 0x11, 0x16, 0xfc, 0x85, 0x72, 0xb2, 0x55,
+    0x48, 0xea, 0x12, 0x04, 0x14, 0xae, 0xce, 0x53, 0xe7, 0x35, 0xf2, 0x4e, 0xd6, 0x26, 0xce, 0x2c,
+    0x97, 0x8e, 0xa8, 0xf9, 0xd7, 0x3f, 0x60, 0x1f, 0x37, 0xd8, 0x93, 0x2d, 0x05, 0xd5, 0xab, 0x6e,
+    0x39, 0x1d, 0x0b, 0x21, 0x91, 0xf7, 0x7e, 0xfe, 0x6c, 0xb9, 0x83, 0xab, 0x33, 0xe6, 0x96, 0x68,
+    0xc1, 0x2e, 0xbb, 0x3b, 0x4b, 0xcc, 0xec, 0x4e, 0x36, 0x73, 0xcd, 0x14, 0xba, 0x22, 0x2d, 0x12,
+    0xbe, 0xb6, 0x12, 0xdd, 0x5a, 0x6a, 0x20, 0xc6, 0xcc, 0xcb, 0x0d, 0x3b, 0x48, 0x01, 0xc5, 0x61,
+    0x2d, 0xb1, 0x72, 0x4d, 0x55, 0x9e, 0x49, 0x3a, 0xd8, 0x9a, 0x30, 0xcf, 0x6a, 0x4e, 0xc6, 0xb9,
+    0x7a, 0x9a, 0x55, 0x92, 0x60, 0xda, 0xa4, 0x2f, 0x30, 0x1a, 0xd2, 0x67, 0x3a, 0xd0, 0x56, 0x5e,
+    0x85, 0x54, 0x2a, 0x81, 0x22, 0x53, 0x05, 0xf2, 0xf2, 0xb3, 0xef, 0xe9, 0xb1, 0xd0, 0x46, 0x3a,
+    0x13, 0x65, 0xa8, 0xe7, 0xb0, 0x22, 0x98, 0xd9, 0x19, 0x16, 0xad, 0xc3, 0xda, 0x86, 0xd8, 0xc9,
+    0xb2, 0x9d, 0x9c, 0x9e, 0xc6, 0xe3, 0xfa, 0xcf, 0x19, 0x59, 0x84, 0xba, 0xe0, 0x21, 0x0a, 0xfa,
+    0x7c, 0x21, 0xb9, 0x33, 0x9a, 0x7b, 0xc5, 0x68, 0xfe, 0x7e, 0x5a, 0x9a, 0xca, 0x5e, 0x91, 0xf9,
+    0x59, 0xa0, 0x92, 0xbd, 0x9c, 0xee, 0x7f, 0x01, 0x89, 0x36, 0xec, 0x1d, 0x14, 0x27, 0x00, 0x00,
+};
+static const WebAsset WEB_HOME_JS = {"/home.1ed9ad9a.js", "application/javascript", WEB_HOME_JS_GZ, sizeof(WEB_HOME_JS_GZ), "\"1ed9ad9a542bd811\"", true};
+
+// config.html: 6609 bytes, 5842 minified, 2274 gzipped
+static const uint8_t WEB_CONFIG_PAGE_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x58, 0x5d, 0x6e, 0xe3, 0xc8,
+    0x11, 0x7e, 0xf7, 0x29, 0x7a, 0xb8, 0xd8, 0x48, 0xca, 0x8a, 0x14, 0x25, 0x4b, 0xb6, 0x86, 0x12,
+    0xb5, 0x19, 0x5b, 0xd6, 0xce, 0x00, 0xf3, 0x87, 0xb5, 0x07, 0x8b, 0x01, 0x8c, 0x05, 0x5a, 0x64,
+    0xd3, 0xea, 0x11, 0xc9, 0x66, 0xc8, 0xa6, 0x65, 0x59, 0xd0, 0xbe, 0xe7, 0x02, 0xb9, 0x41, 0x6e,
+    0x91, 0x9c, 0x21, 0x77, 0xc8, 0x05, 0x72, 0x85, 0x54, 0x75, 0x53, 0xa2, 0x28, 0x4b, 0x33, 0xce,
+    0xbe, 0x04, 0x08, 0x0c, 0x4b, 0x64, 0xb3, 0xaa, 0xbb, 0xea, 0xab, 0xaf, 0x7e, 0xa8, 0xe1, 0x8b,
+    0xf1, 0x87, 0xcb, 0x9b, 0xcf, 0x1f, 0xaf, 0xc8, 0x4c, 0x46, 0xe1, 0xe8, 0x64, 0x88, 0x5f, 0x24,
+    0xa4, 0xf1, 0x9d, 0x6b, 0xb0, 0xd8, 0x18, 0x0d, 0x67, 0x8c, 0xfa, 0xb0, 0x1c, 0x31, 0x49, 0x89,
+    0x37, 0xa3, 0x69, 0xc6, 0xa4, 0x6b, 0x7c, 0xba, 0x99, 0x98, 0x7d, 0x63, 0xb3, 0x1c, 0xd3, 0x88,
+    0xb9, 0xc6, 0x3d, 0x67, 0x8b, 0x44, 0xa4, 0xd2, 0x20, 0x9e, 0x88, 0x25, 0x8b, 0x41, 0x6c, 0xc1,
+    0x7d, 0x39, 0x73, 0x7d, 0x76, 0xcf, 0x3d, 0x66, 0xaa, 0x9b, 0x26, 0xe1, 0x31, 0x97, 0x9c, 0x86,
+    0x66, 0xe6, 0xd1, 0x90, 0xb9, 0x6d, 0xcb, 0x6e, 0x92, 0x88, 0x3e, 0xf0, 0x28, 0x8f, 0x76, 0x97,
+    0xf2, 0x8c, 0xa5, 0xea, 0x9e, 0x4e, 0x61, 0x29, 0x16, 0x78, 0x96, 0xe4, 0x32, 0x64, 0xa3, 0x5f,
+    0xf8, 0x84, 0x93, 0x6b, 0x26, 0xf3, 0x64, 0xd8, 0xd2, 0x2b, 0x27, 0xc3, 0x4c, 0x2e, 0xe1, 0xfb,
+    0x8f, 0xab, 0xa9, 0x78, 0x30, 0x33, 0xfe, 0xc8, 0xe3, 0x3b, 0x67, 0x2a, 0x52, 0x1f, 0xb6, 0x80,
+    0x95, 0x41, 0x44, 0xd3, 0x3b, 0x1e, 0x3b, 0xf6, 0x20, 0xa1, 0xbe, 0x8f, 0xcf, 0xec, 0x81, 0xc8,
+    0x65, 0xc8, 0x63, 0xe6, 0xc4, 0x22, 0x66, 0x03, 0x73, 0xc1, 0xa6, 0x73, 0x2e, 0x4d, 0x49, 0x13,
+    0x73, 0xc6, 0xef, 0x66, 0x21, 0xfc, 0x4b, 0xd3, 0x13, 0xa1, 0x48, 0x1d, 0x99, 0xd2, 0x38, 0x4b,
+    0x68, 0x0a, 0xee, 0xac, 0xa7, 0xc2, 0x5f, 0xae, 0x02, 0xf0, 0xcd, 0x0c, 0x68, 0xc4, 0xc3, 0xa5,
+    0x63, 0xd2, 0x24, 0x09, 0x99, 0x99, 0x2d, 0x33, 0xc9, 0xa2, 0xe6, 0x05, 0xec, 0x38, 0x7f, 0x47,
+    0xbd, 0x6b, 0x75, 0x3b, 0x01, 0xb9, 0xa6, 0x71, 0xcd, 0xee, 0x04, 0x23, 0x9f, 0xde, 0x18, 0xcd,
+    0x9f, 0xc5, 0x54, 0x48, 0xd1, 0x7c, 0xcd, 0xc2, 0x7b, 0x26, 0xb9, 0x47, 0x9b, 0xaf, 0x52, 0x40,
+    0xa1, 0x99, 0xc1, 0xf6, 0x26, 0xf8, 0xca, 0x83, 0xc1, 0x94, 0x7a, 0xf3, 0xbb, 0x54, 0xe4, 0xb1,
+    0xef, 0x7c, 0x37, 0x99, 0x4c, 0xfa, 0x13, 0x7b, 0xa0, 0x6d, 0xf8, 0xee, 0x6c, 0xdc, 0xbd, 0xec,
+    0xb6, 0x07, 0x3e, 0xcf, 0x92, 0x90, 0x2e, 0x9d, 0x20, 0x64, 0x0f, 0x03, 0x0a, 0x56, 0xc6, 0x26,
+    0x87, 0x93, 0x32, 0xc7, 0x03, 0xeb, 0x58, 0x3a, 0xf8, 0x92, 0x67, 0x92, 0x07, 0x4b, 0xb3, 0x80,
+    0x7f, 0xb3, 0x1c, 0xf1, 0xd8, 0x9c, 0x31, 0xf4, 0xc9, 0x69, 0xdb, 0xf6, 0xfd, 0x6c, 0x0b, 0x43,
+    0xc7, 0x4e, 0x1e, 0xd6, 0x16, 0x4a, 0x53, 0xc0, 0x22, 0x5d, 0xed, 0x19, 0x30, 0x50, 0x01, 0x43,
+    0x9d, 0xef, 0x01, 0xc2, 0x07, 0x1d, 0x3f, 0xe7, 0xf4, 0x0c, 0xb4, 0xb6, 0x5b, 0x74, 0xe1, 0x86,
+    0x9c, 0xe2, 0x4a, 0x81, 0x77, 0x4a, 0x7d, 0x9e, 0x67, 0x4e, 0xb1, 0x04, 0xd1, 0x98, 0x51, 0x5f,
+    0x2c, 0x1c, 0x9b, 0xb4, 0x51, 0xb2, 0xd3, 0x83, 0x8f, 0xf4, 0x6e, 0x4a, 0xeb, 0x9d, 0x5e, 0xaf,
+    0xd9, 0xee, 0x9f, 0x36, 0xdb, 0xe7, 0xfd, 0xa6, 0x6d, 0x75, 0x1a, 0x03, 0xc9, 0x1e, 0xa4, 0xa9,
+    0x9c, 0xda, 0xd8, 0x9d, 0x88, 0x0c, 0x98, 0x22, 0x62, 0x27, 0x65, 0x21, 0x95, 0xfc, 0x9e, 0x0d,
+    0xc4, 0x3d, 0x4b, 0x83, 0x10, 0xb6, 0x9b, 0x71, 0xdf, 0x67, 0xf1, 0x8e, 0xed, 0x8e, 0x33, 0x65,
+    0x81, 0x48, 0xd9, 0x6a, 0xe3, 0x7b, 0xad, 0x56, 0xea, 0xd3, 0x69, 0x26, 0xc2, 0x5c, 0xb2, 0x81,
+    0x14, 0x09, 0xc4, 0x3e, 0x64, 0x81, 0x84, 0xaf, 0x1d, 0xef, 0x0a, 0x74, 0xfa, 0x68, 0x73, 0x05,
+    0x83, 0x8b, 0xf3, 0x8b, 0xce, 0xda, 0x9a, 0x53, 0x11, 0x89, 0x2f, 0x5c, 0x87, 0x1e, 0xe8, 0xc5,
+    0x9c, 0x1e, 0xba, 0xa7, 0x6e, 0x17, 0x5a, 0x75, 0x2a, 0x42, 0x7f, 0x13, 0x2d, 0xad, 0x56, 0xb0,
+    0x0e, 0x08, 0x28, 0xa5, 0x88, 0x1c, 0x74, 0x7f, 0x1b, 0x40, 0x1e, 0x23, 0xf9, 0xcc, 0x69, 0x28,
+    0xbc, 0xf9, 0x60, 0x31, 0x83, 0x20, 0x9a, 0xc0, 0x31, 0x0f, 0xe9, 0xb8, 0x48, 0x69, 0x32, 0xa0,
+    0x31, 0x8f, 0xa8, 0x32, 0x7d, 0x0a, 0x96, 0x78, 0x8c, 0x74, 0x32, 0x48, 0x9b, 0x00, 0x33, 0x87,
+    0x11, 0x46, 0x33, 0x66, 0xc2, 0xc6, 0x40, 0x61, 0x0d, 0x5a, 0x01, 0x71, 0x07, 0xf1, 0x85, 0x7f,
+    0xc4, 0x19, 0xc3, 0xd7, 0xec, 0xc2, 0x45, 0xb7, 0x58, 0x38, 0x80, 0xf9, 0x69, 0x63, 0x3d, 0x6b,
+    0xef, 0xf8, 0xd4, 0xe9, 0xee, 0xf9, 0x74, 0x6e, 0xdb, 0x7b, 0x4e, 0x20, 0x40, 0x85, 0x93, 0xbd,
+    0x71, 0xd7, 0x3e, 0x3d, 0x5f, 0x27, 0x3b, 0x1b, 0xb4, 0xbb, 0xe5, 0xe3, 0x57, 0xed, 0x7e, 0xff,
+    0x7c, 0xb2, 0xa7, 0x7e, 0xaa, 0xf8, 0x06, 0x61, 0x8a, 0x4c, 0x84, 0x38, 0x59, 0x55, 0x1f, 0x23,
+    0x1d, 0x77, 0x69, 0x80, 0x71, 0x5a, 0x43, 0xfe, 0xb3, 0x70, 0xb5, 0x01, 0x4e, 0x23, 0xb6, 0x73,
+    0xe4, 0xe9, 0x9e, 0xcd, 0x67, 0x07, 0x6d, 0x2e, 0x56, 0x54, 0xe0, 0x55, 0x20, 0x0a, 0x2b, 0xfb,
+    0xe3, 0xb3, 0xab, 0xb3, 0x53, 0x7d, 0xa6, 0x4a, 0x74, 0xb4, 0xcd, 0xc9, 0x93, 0x84, 0xa5, 0x1e,
+    0xa0, 0x0c, 0x4c, 0x91, 0x12, 0xcb, 0x10, 0xc4, 0x46, 0x95, 0x0d, 0x0b, 0xe8, 0xbb, 0xce, 0x58,
+    0xc8, 0x3c, 0xd9, 0xe4, 0x71, 0x92, 0xcb, 0xd5, 0x0e, 0x89, 0x36, 0x29, 0x81, 0x30, 0x90, 0x4e,
+    0x99, 0x12, 0x2a, 0x30, 0x40, 0x40, 0xee, 0x43, 0x58, 0x2e, 0xae, 0x5e, 0x5e, 0x9d, 0xef, 0xe5,
+    0x4a, 0x67, 0x4b, 0x26, 0xed, 0xd3, 0xd9, 0x13, 0x1a, 0x4e, 0xc6, 0x93, 0x8b, 0x2a, 0xf0, 0x03,
+    0x65, 0x6e, 0x41, 0xef, 0x30, 0x24, 0xd6, 0x69, 0xa6, 0x88, 0x31, 0x80, 0x8a, 0xc4, 0x28, 0x3c,
+    0xf3, 0x74, 0x6d, 0x5b, 0x5b, 0xda, 0x5c, 0x13, 0x79, 0x05, 0x6e, 0xad, 0x9e, 0x24, 0xd5, 0xbe,
+    0x84, 0xe3, 0xd0, 0x00, 0x9c, 0x2e, 0x13, 0xe9, 0x5f, 0x7f, 0xfd, 0x7b, 0x6d, 0xd7, 0xbc, 0x4e,
+    0x89, 0x5f, 0xc1, 0xf4, 0xa7, 0x89, 0x96, 0xaa, 0x60, 0xe8, 0x80, 0x42, 0xce, 0xf5, 0x00, 0x9e,
+    0x12, 0x5f, 0x75, 0x05, 0x87, 0xb3, 0xcf, 0x75, 0x13, 0x9e, 0x34, 0x40, 0x9f, 0x63, 0xc2, 0x9b,
+    0xec, 0x1e, 0x0e, 0xcc, 0xb4, 0xdd, 0xda, 0x28, 0x27, 0x10, 0x5e, 0x9e, 0x69, 0xac, 0xf5, 0xf5,
+    0xaa, 0xc0, 0xae, 0x6a, 0xc1, 0x7e, 0xe5, 0xaa, 0x54, 0x1e, 0xfc, 0xeb, 0x1e, 0xab, 0x3b, 0xeb,
+    0x69, 0x0e, 0x34, 0x89, 0x0f, 0x06, 0xf2, 0xac, 0xa4, 0x0e, 0x7a, 0xa1, 0x98, 0xf3, 0xb4, 0x3e,
+    0x94, 0x60, 0x4c, 0x36, 0x11, 0x57, 0x5d, 0xe5, 0xdb, 0x41, 0x7e, 0x5a, 0x40, 0xf2, 0x34, 0x83,
+    0xad, 0x0a, 0x3c, 0x76, 0x63, 0xbc, 0x45, 0x8f, 0x58, 0x6d, 0x1d, 0xe9, 0x66, 0x69, 0x89, 0x06,
+    0x03, 0x39, 0x50, 0x75, 0x1c, 0x9d, 0x6e, 0x1f, 0xc9, 0xfe, 0xee, 0xc6, 0x73, 0x87, 0x7a, 0x48,
+    0x83, 0x55, 0x19, 0x1f, 0xd5, 0x85, 0xeb, 0xb6, 0xf5, 0xf2, 0xac, 0xb1, 0xe7, 0x6e, 0xff, 0xd5,
+    0x59, 0xaf, 0x50, 0xb3, 0x42, 0x41, 0x11, 0xa5, 0x4a, 0xd3, 0x18, 0x9f, 0x5f, 0x5e, 0x5e, 0xf6,
+    0x0f, 0xc5, 0x73, 0xe3, 0x9a, 0xcf, 0x02, 0x9a, 0x87, 0x72, 0xfd, 0xa7, 0x39, 0x5b, 0x06, 0x29,
+    0x8c, 0x0d, 0x19, 0xd1, 0x25, 0x6e, 0x65, 0x7f, 0xdf, 0x44, 0xf4, 0x57, 0x07, 0x79, 0x62, 0x37,
+    0xd6, 0xbd, 0x63, 0xcf, 0x4c, 0x74, 0xb1, 0xb1, 0xc6, 0xc2, 0x22, 0x90, 0xb8, 0x3b, 0x11, 0xc3,
+    0x76, 0x73, 0x84, 0xba, 0xda, 0xd4, 0xf5, 0xb0, 0xa5, 0x47, 0x87, 0x93, 0x61, 0xab, 0x98, 0x73,
+    0xb0, 0xc9, 0xc3, 0x97, 0xcf, 0xef, 0x89, 0x17, 0xd2, 0x2c, 0x73, 0x8d, 0x6d, 0x93, 0x31, 0xaa,
+    0xeb, 0x45, 0x5b, 0x30, 0x46, 0x75, 0xf7, 0xd7, 0x7f, 0xff, 0xe3, 0x6f, 0xff, 0xfc, 0x0b, 0x7c,
+    0xfc, 0xea, 0x36, 0x86, 0x2d, 0x90, 0xc1, 0x39, 0xaa, 0x3d, 0x82, 0x66, 0x1f, 0x0a, 0xf2, 0x3a,
+    0x8f, 0x68, 0xfc, 0x02, 0x0e, 0x68, 0xc3, 0x6a, 0x32, 0xfa, 0x18, 0x62, 0xf8, 0x70, 0x46, 0x8a,
+    0x81, 0xe1, 0x24, 0x62, 0x44, 0x0a, 0x22, 0x67, 0x8c, 0x28, 0xd0, 0x62, 0x26, 0xc9, 0x6f, 0xc3,
+    0x56, 0x02, 0xa2, 0x2a, 0xdc, 0xdc, 0xc7, 0x29, 0x2a, 0xe0, 0x13, 0xb8, 0x31, 0x08, 0xc6, 0x4a,
+    0xc4, 0xae, 0xd1, 0x02, 0xed, 0x80, 0xdf, 0xe5, 0x29, 0x33, 0x60, 0x03, 0x39, 0x13, 0x20, 0xf5,
+    0xf1, 0xc3, 0xf5, 0xcd, 0x9e, 0x85, 0x65, 0xa9, 0xc5, 0x07, 0xaa, 0x94, 0x12, 0x58, 0x73, 0x8d,
+    0x2c, 0xe3, 0xbe, 0x31, 0x7a, 0xcf, 0xe4, 0x42, 0xa4, 0x73, 0xf2, 0x1e, 0xe2, 0x30, 0x6c, 0xa9,
+    0xc7, 0x55, 0xfd, 0x6a, 0x65, 0x30, 0x94, 0x31, 0xa8, 0xba, 0x5d, 0xc1, 0xd1, 0x4b, 0xc9, 0x6c,
+    0x1f, 0x19, 0xc5, 0x30, 0xa8, 0xaf, 0x53, 0xf6, 0xe7, 0x9c, 0xa7, 0x0c, 0x71, 0x15, 0x09, 0x9a,
+    0x4e, 0xee, 0x69, 0x98, 0xc3, 0x63, 0x83, 0x40, 0x49, 0xc7, 0xd1, 0xce, 0x27, 0x7a, 0x03, 0x90,
+    0xb9, 0x86, 0xc2, 0xe5, 0xcd, 0x80, 0x53, 0x96, 0x65, 0x0d, 0x5b, 0x5a, 0x1e, 0x03, 0xa3, 0x05,
+    0xf0, 0x4a, 0x03, 0x5b, 0x7c, 0x3d, 0xc7, 0xcf, 0x04, 0x1e, 0x83, 0x8b, 0xe0, 0xeb, 0xc7, 0xe2,
+    0xaa, 0xf4, 0x53, 0x15, 0x15, 0x22, 0x97, 0x09, 0xdb, 0x91, 0x53, 0x7e, 0x94, 0x77, 0xda, 0x97,
+    0xf2, 0x1e, 0x9a, 0x90, 0xc7, 0x66, 0x90, 0xaa, 0x0c, 0x36, 0x7f, 0xcb, 0xe8, 0x3d, 0xb4, 0xe3,
+    0x28, 0x91, 0x4b, 0xc2, 0x03, 0x22, 0x12, 0x1c, 0x97, 0xff, 0x2b, 0xf3, 0xe4, 0xa3, 0x31, 0xba,
+    0xe1, 0x11, 0x7b, 0x84, 0x0c, 0x79, 0x4e, 0x00, 0xaa, 0x70, 0x83, 0x76, 0x61, 0xa0, 0x7c, 0xfc,
+    0x10, 0x04, 0x30, 0x97, 0x7f, 0x05, 0xf0, 0x4e, 0xbf, 0x6f, 0xdb, 0x46, 0x09, 0xf6, 0x4f, 0xef,
+    0x6e, 0x7e, 0xb0, 0xfb, 0x8e, 0x6d, 0x93, 0xfa, 0x05, 0xe3, 0x5f, 0x00, 0xf5, 0xc6, 0x0e, 0xe6,
+    0x55, 0x5d, 0xdb, 0xd0, 0xe2, 0xb6, 0x12, 0xff, 0x74, 0x73, 0x79, 0x5c, 0xb4, 0xfd, 0x12, 0x8f,
+    0xd1, 0xe2, 0x3d, 0x68, 0xf8, 0xa4, 0xfe, 0x26, 0xf6, 0x39, 0x3d, 0xae, 0xd0, 0xe9, 0x75, 0xb6,
+    0x0a, 0xe7, 0xda, 0x1c, 0x78, 0xf5, 0x98, 0x8b, 0xf9, 0x71, 0x95, 0xd3, 0x4e, 0x77, 0xab, 0xf2,
+    0x52, 0xa9, 0xdc, 0x88, 0xf9, 0x52, 0x7c, 0x45, 0xe1, 0x6c, 0x2b, 0xdf, 0x2e, 0x3c, 0x4e, 0x61,
+    0x00, 0x3b, 0xae, 0x60, 0xb6, 0xc1, 0x0b, 0xad, 0x62, 0x82, 0x1b, 0xa8, 0xf2, 0x9e, 0x2d, 0xc8,
+    0x67, 0x48, 0x96, 0xaf, 0x28, 0x95, 0xae, 0x98, 0x85, 0x2b, 0x63, 0x16, 0xc3, 0xc4, 0xfa, 0x35,
+    0x95, 0x7e, 0x7f, 0xab, 0xa2, 0x83, 0x71, 0x4d, 0x63, 0x32, 0xc1, 0xfe, 0xcd, 0x33, 0xaf, 0xe2,
+    0xd2, 0xb1, 0x34, 0xd0, 0xe5, 0xb8, 0xe0, 0x71, 0x96, 0x4f, 0x23, 0x2e, 0x8b, 0x44, 0x05, 0x76,
+    0x5e, 0x48, 0xa0, 0xe4, 0x35, 0xd2, 0xf4, 0x0f, 0xe4, 0x52, 0x17, 0x9c, 0x61, 0x4b, 0x6b, 0xec,
+    0xab, 0xea, 0x1b, 0xad, 0x9a, 0x32, 0x20, 0x13, 0xea, 0x12, 0x55, 0x1d, 0x5d, 0x63, 0xb7, 0xa6,
+    0x76, 0xf7, 0xba, 0xe0, 0x95, 0x8d, 0x7f, 0xd5, 0x57, 0x15, 0x63, 0xf4, 0x33, 0x6e, 0x41, 0x7e,
+    0xe1, 0xe6, 0x84, 0xef, 0x9c, 0xd8, 0xc2, 0x54, 0xd8, 0x4f, 0x0e, 0xac, 0xda, 0x90, 0xa0, 0x20,
+    0x3e, 0x56, 0x2f, 0x8a, 0x68, 0xa9, 0x2a, 0x6e, 0x6a, 0x04, 0xde, 0x73, 0x37, 0xf3, 0x52, 0x9e,
+    0xc8, 0x11, 0xcd, 0x96, 0xb1, 0x47, 0x02, 0xe8, 0x1c, 0x0a, 0x4f, 0x6c, 0x46, 0x45, 0x35, 0xcb,
+    0xea, 0x14, 0x86, 0x36, 0x48, 0x4a, 0xd7, 0x6e, 0xac, 0x4e, 0x64, 0xba, 0x5c, 0x9d, 0x40, 0xb1,
+    0xcc, 0x24, 0xa4, 0x46, 0x46, 0x5c, 0x42, 0x17, 0x94, 0x4b, 0x12, 0x30, 0xe9, 0xcd, 0xea, 0xb5,
+    0x16, 0xb4, 0xba, 0xb8, 0xd6, 0x18, 0x14, 0x12, 0x21, 0x87, 0x8f, 0x8d, 0x08, 0x88, 0x5b, 0x5f,
+    0x32, 0x11, 0xd7, 0xb7, 0x8f, 0x8b, 0x2c, 0x04, 0x09, 0x1f, 0x26, 0x91, 0x08, 0x7a, 0x9b, 0x75,
+    0xc7, 0xe4, 0x55, 0xc8, 0xf0, 0xf2, 0x62, 0xf9, 0xc6, 0xaf, 0xd7, 0x76, 0x8b, 0x63, 0xb9, 0x2f,
+    0x44, 0xee, 0x5b, 0x4a, 0x28, 0x0c, 0x35, 0xa4, 0x8e, 0x26, 0x58, 0x21, 0x8b, 0xef, 0xe4, 0x8c,
+    0xb8, 0xae, 0x4b, 0xec, 0x06, 0x59, 0x9d, 0x80, 0xbe, 0xc5, 0x21, 0x78, 0xe9, 0xeb, 0x9b, 0x77,
+    0x6f, 0x61, 0xa7, 0x5a, 0x95, 0x46, 0xb7, 0xc6, 0xed, 0xb3, 0xcb, 0x69, 0x4d, 0x1f, 0x53, 0x40,
+    0x44, 0x86, 0xa4, 0xa7, 0x0f, 0x90, 0x58, 0x86, 0xe0, 0x8d, 0xa2, 0x5e, 0x6f, 0xb8, 0xa3, 0x43,
+    0x68, 0xfe, 0xd0, 0x6e, 0x34, 0x49, 0x1b, 0x08, 0x0e, 0x86, 0xae, 0x09, 0x0b, 0xa1, 0x83, 0xad,
+    0x4e, 0x0a, 0x4f, 0xf7, 0x8c, 0xd3, 0x85, 0x15, 0x78, 0x74, 0xab, 0xba, 0xc0, 0x6d, 0x51, 0xa5,
+    0xb6, 0x77, 0x9b, 0x1a, 0x55, 0xa9, 0xa6, 0xb7, 0xc6, 0x15, 0xb6, 0x3f, 0x72, 0x7d, 0xfd, 0x66,
+    0x4c, 0xa0, 0x5f, 0xe6, 0x30, 0xd5, 0x2e, 0x6f, 0x37, 0x04, 0xbc, 0x35, 0xfe, 0x67, 0x83, 0x36,
+    0xd8, 0xd0, 0x42, 0xd8, 0xd6, 0xa5, 0xdb, 0xbf, 0x37, 0x1e, 0xaa, 0x72, 0xe3, 0xcf, 0x17, 0xbb,
+    0xe1, 0x50, 0x11, 0x87, 0xb4, 0xb8, 0xa2, 0xc0, 0x48, 0x44, 0xc8, 0x1d, 0x6d, 0x18, 0x0b, 0x42,
+    0xee, 0x96, 0x35, 0x5e, 0xca, 0x60, 0xdc, 0x29, 0x88, 0x53, 0xaf, 0xe9, 0x0d, 0x90, 0x36, 0x70,
+    0x65, 0xe9, 0x83, 0x51, 0x7b, 0x80, 0x5a, 0x16, 0xbe, 0xd1, 0x5c, 0x16, 0x3f, 0xc2, 0xa8, 0x55,
+    0x65, 0x33, 0x06, 0x2b, 0xf6, 0x2f, 0x67, 0x3c, 0xf4, 0xeb, 0x20, 0x85, 0x91, 0x6c, 0x28, 0xc7,
+    0x3c, 0x8a, 0xe9, 0xc0, 0x1a, 0xab, 0xdf, 0xcf, 0xf4, 0x27, 0x54, 0x70, 0xff, 0x8f, 0x89, 0x70,
+    0x72, 0xa0, 0xfc, 0xdc, 0x3c, 0xd6, 0xbf, 0x5d, 0x6f, 0x68, 0xc2, 0x5b, 0xf2, 0xb1, 0xac, 0x0c,
+    0x58, 0x60, 0x0e, 0x56, 0x1c, 0x4c, 0x52, 0xac, 0xcb, 0x22, 0x50, 0x32, 0xd6, 0xa6, 0xc3, 0x93,
+    0x17, 0x50, 0x14, 0x6a, 0x60, 0x24, 0x0b, 0x60, 0x22, 0x85, 0xb2, 0x01, 0x74, 0x3c, 0x1a, 0x23,
+    0x3c, 0x49, 0x53, 0x03, 0xce, 0xa8, 0x6c, 0x73, 0x20, 0xea, 0x22, 0x64, 0xd6, 0x82, 0xa6, 0x71,
+    0xbd, 0xa6, 0xbd, 0x21, 0x01, 0xe5, 0xc0, 0xdf, 0x5a, 0x93, 0x30, 0x4d, 0x92, 0xe3, 0xe7, 0x6c,
+    0xe6, 0x53, 0x38, 0x0d, 0x22, 0x72, 0x85, 0x53, 0xff, 0x5b, 0x60, 0x35, 0x03, 0x26, 0x00, 0x51,
+    0x54, 0x4b, 0x82, 0x6d, 0x34, 0x66, 0x70, 0x1e, 0x12, 0x9c, 0x59, 0x49, 0xaa, 0x5e, 0x0f, 0xc6,
+    0xfa, 0x85, 0xa0, 0xac, 0xb2, 0x53, 0x19, 0xbb, 0xc7, 0x59, 0xa7, 0x7b, 0x1a, 0x02, 0x08, 0x72,
+    0x15, 0x9a, 0xd7, 0x8a, 0xfe, 0xa6, 0x0b, 0x5e, 0x4d, 0x0b, 0xa8, 0x1e, 0x83, 0xb6, 0xa0, 0x61,
+    0xda, 0x33, 0x78, 0x5e, 0xe2, 0x1f, 0xf8, 0x6e, 0x0c, 0x8d, 0x1d, 0x8d, 0x1f, 0x53, 0x49, 0xeb,
+    0xcc, 0x92, 0xd0, 0xe9, 0x18, 0xa6, 0x46, 0x35, 0x70, 0xdb, 0x79, 0xbb, 0xd6, 0x5c, 0xe9, 0x81,
+    0xdb, 0xa9, 0xe1, 0xc0, 0x5d, 0x6b, 0xe2, 0xfb, 0x82, 0x13, 0xf8, 0xeb, 0x43, 0x26, 0x61, 0xe7,
+    0xf5, 0x6b, 0x3a, 0xcd, 0x8e, 0xfa, 0xb4, 0x69, 0xb6, 0x07, 0xd1, 0xf3, 0x42, 0xee, 0xcd, 0x4b,
+    0xf0, 0x14, 0x76, 0xc8, 0x8d, 0x17, 0xca, 0xa0, 0x34, 0xaa, 0xd7, 0x2e, 0xf5, 0x05, 0x49, 0xcb,
+    0x86, 0x0b, 0x35, 0x47, 0x22, 0x0e, 0xd9, 0x8f, 0xb5, 0x46, 0x03, 0x1e, 0xc8, 0x3c, 0x8d, 0x9f,
+    0x05, 0x6f, 0x69, 0xca, 0x01, 0x67, 0x54, 0x47, 0x7f, 0x2e, 0xbc, 0x55, 0xf4, 0xd4, 0xbe, 0x07,
+    0x37, 0x1d, 0xc3, 0xe4, 0x5b, 0x00, 0xb4, 0xe0, 0x31, 0xbc, 0xb6, 0x5a, 0x22, 0xc6, 0x6d, 0x5c,
+    0xed, 0x6a, 0xa5, 0x13, 0x81, 0xcc, 0x26, 0xd1, 0x40, 0x63, 0x00, 0x13, 0x91, 0x9e, 0x05, 0x60,
+    0x36, 0x28, 0x5e, 0xda, 0x5a, 0xea, 0x27, 0xec, 0xff, 0x00, 0x89, 0xd5, 0x67, 0x86, 0xd2, 0x16,
+    0x00, 0x00,
+};
+static const WebAsset WEB_CONFIG_PAGE = {"/wifi", "text/html", WEB_CONFIG_PAGE_GZ, sizeof(WEB_CONFIG_PAGE_GZ), "\"912b42baa1795f3b\"", false};
+
+// home.html: 3914 bytes, 2938 minified, 1183 gzipped
+static const uint8_t WEB_HOME_PAGE_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x56, 0xcd, 0x6e, 0xe3, 0x36,
+    0x10, 0xbe, 0xe7, 0x29, 0xb8, 0x5c, 0x14, 0xeb, 0xa0, 0xa1, 0x7f, 0xb2, 0x49, 0x9b, 0xda, 0x96,
+    0x80, 0xdd, 0xa4, 0x41, 0x0e, 0xf1, 0x26, 0x40, 0x52, 0x2c, 0x7a, 0x59, 0x80, 0x96, 0xc6, 0x16,
+    0x13, 0x8a, 0xd4, 0x8a, 0x94, 0x9d, 0xec, 0xbd, 0x87, 0x9e, 0x16, 0x68, 0x4f, 0xed, 0xa5, 0x87,
+    0x62, 0xd1, 0x07, 0xe8, 0xa5, 0x97, 0x3e, 0x43, 0xdf, 0xa1, 0x2f, 0xb0, 0x7d, 0x84, 0x0e, 0x29,
+    0xc9, 0x91, 0x63, 0x3b, 0xe9, 0x16, 0x09, 0x2c, 0x71, 0x38, 0xf3, 0x71, 0x7e, 0xbe, 0x19, 0x71,
+    0xf8, 0xe4, 0xe8, 0xec, 0xf0, 0xf2, 0xdb, 0xf3, 0xaf, 0x49, 0x62, 0x53, 0x19, 0x6e, 0x0d, 0xdd,
+    0x83, 0x48, 0xae, 0xa6, 0x01, 0x05, 0x45, 0x9d, 0x00, 0x78, 0x8c, 0x8f, 0x14, 0x2c, 0x27, 0x51,
+    0xc2, 0x73, 0x03, 0x36, 0xa0, 0xdf, 0x5c, 0x1e, 0xb3, 0x03, 0x5a, 0x8b, 0x15, 0x4f, 0x21, 0xa0,
+    0x33, 0x01, 0xf3, 0x4c, 0xe7, 0x96, 0x92, 0x48, 0x2b, 0x0b, 0x0a, 0xd5, 0xe6, 0x22, 0xb6, 0x49,
+    0x10, 0xc3, 0x4c, 0x44, 0xc0, 0xfc, 0x62, 0x87, 0x08, 0x25, 0xac, 0xe0, 0x92, 0x99, 0x88, 0x4b,
+    0x08, 0x7a, 0xed, 0xee, 0x0e, 0x49, 0xf9, 0x8d, 0x48, 0x8b, 0xb4, 0x29, 0x2a, 0x0c, 0xe4, 0x7e,
+    0xcd, 0xc7, 0x28, 0x52, 0xda, 0x9d, 0x65, 0x85, 0x95, 0x10, 0x9e, 0x83, 0x25, 0x47, 0xdc, 0x24,
+    0x63, 0xcd, 0xf3, 0x78, 0xd8, 0x29, 0x85, 0x5b, 0x43, 0x29, 0xd4, 0x35, 0xc9, 0x41, 0x06, 0xd4,
+    0xd8, 0x5b, 0x09, 0x26, 0x01, 0x40, 0x4f, 0x92, 0x1c, 0x26, 0x01, 0xed, 0x24, 0x3a, 0x85, 0x76,
+    0x74, 0xb0, 0xbb, 0xcf, 0xf7, 0xf7, 0xbf, 0x6c, 0x47, 0xc6, 0x38, 0xb8, 0x4e, 0x15, 0xd9, 0x58,
+    0xc7, 0xb7, 0xf8, 0x88, 0xc5, 0x8c, 0x88, 0x38, 0xa0, 0xe8, 0x42, 0x6e, 0xd9, 0x98, 0x2b, 0x05,
+    0x39, 0x25, 0x1e, 0x2c, 0xa0, 0xb1, 0x30, 0x99, 0xe4, 0xb7, 0x7d, 0xa5, 0x15, 0xd0, 0x70, 0xd8,
+    0x41, 0xe5, 0x86, 0x89, 0xd4, 0x3c, 0x16, 0x6a, 0x7a, 0x36, 0x83, 0x1c, 0x95, 0x16, 0x46, 0x99,
+    0x36, 0x18, 0xaa, 0x56, 0xfd, 0x89, 0xb8, 0x81, 0x78, 0x40, 0xac, 0xce, 0xfa, 0xdd, 0x01, 0x91,
+    0x30, 0xb1, 0xee, 0xe9, 0xf3, 0xd1, 0xef, 0x75, 0xbb, 0x9f, 0x0d, 0x48, 0x02, 0x62, 0x9a, 0xd8,
+    0x6a, 0x31, 0xe6, 0xd1, 0xf5, 0x34, 0xd7, 0x85, 0x8a, 0xfb, 0xf9, 0x74, 0xcc, 0x5b, 0xdd, 0x1d,
+    0xff, 0xd7, 0xde, 0xdf, 0x1e, 0x90, 0x77, 0x4c, 0xa8, 0x18, 0x6e, 0xfa, 0xbb, 0x5d, 0x44, 0x68,
+    0x7a, 0x35, 0x20, 0x5c, 0x8a, 0xa9, 0x62, 0xc2, 0x42, 0x6a, 0xfa, 0x11, 0xa6, 0x1f, 0xf2, 0x01,
+    0xb9, 0x2a, 0x8c, 0x15, 0x93, 0x5b, 0x56, 0x55, 0xa4, 0x96, 0xd3, 0xca, 0xf9, 0xca, 0xd1, 0xc6,
+    0x81, 0x4f, 0x27, 0x93, 0xc9, 0x80, 0x64, 0x3c, 0x76, 0x01, 0xf5, 0x9f, 0x77, 0xb3, 0x1b, 0xf4,
+    0x47, 0xe7, 0x31, 0x56, 0x23, 0xc7, 0x20, 0x0b, 0x83, 0x27, 0x3b, 0x99, 0x85, 0x1b, 0xcb, 0xfc,
+    0x89, 0x1b, 0x30, 0x27, 0x78, 0x22, 0x33, 0xe2, 0x1d, 0xf4, 0xf7, 0xbc, 0x41, 0xca, 0xf3, 0xa9,
+    0x50, 0x6c, 0xac, 0xad, 0xd5, 0x29, 0x06, 0x8a, 0x32, 0x1a, 0xfe, 0xfd, 0xfe, 0xf7, 0x0d, 0xb9,
+    0xbc, 0x44, 0xfc, 0x45, 0x22, 0x23, 0x2d, 0x75, 0xde, 0x7f, 0xfa, 0xc5, 0xd1, 0xde, 0xe1, 0x5e,
+    0x6f, 0x40, 0x3c, 0xf4, 0xbc, 0xcc, 0xd8, 0x58, 0xcb, 0x18, 0x81, 0x2e, 0xf8, 0x0c, 0x8d, 0xda,
+    0xed, 0x76, 0x0d, 0xb7, 0xfc, 0x70, 0x95, 0x86, 0xbc, 0x3c, 0x05, 0x7f, 0x4d, 0xc6, 0x15, 0x89,
+    0x24, 0x37, 0x26, 0xa0, 0xd7, 0x5c, 0xa7, 0xfa, 0x4a, 0xb0, 0x52, 0x85, 0x86, 0xad, 0xe0, 0xcd,
+    0xc7, 0x3f, 0x3f, 0xfc, 0xf5, 0x3d, 0xfe, 0xbc, 0x09, 0xb6, 0xc9, 0x08, 0xf4, 0xfc, 0xc9, 0xb0,
+    0xe3, 0x2c, 0x1c, 0x4e, 0xcf, 0xd3, 0xef, 0x18, 0x00, 0x75, 0x91, 0x40, 0xbd, 0xbb, 0x23, 0xc6,
+    0x05, 0x06, 0xb6, 0x40, 0xc5, 0x26, 0xb1, 0xe8, 0x90, 0x61, 0x63, 0xab, 0x28, 0xd1, 0x2a, 0x92,
+    0x22, 0xba, 0x0e, 0xa8, 0xce, 0x40, 0x5d, 0x54, 0x5b, 0xad, 0x6d, 0x8c, 0xff, 0xe7, 0x9f, 0x3e,
+    0xfe, 0xf1, 0x7e, 0xd8, 0x29, 0x8d, 0x6b, 0x4e, 0xd6, 0x9e, 0x2e, 0xc0, 0x2c, 0xb7, 0x85, 0x61,
+    0xd3, 0x5c, 0xc4, 0x74, 0x79, 0x27, 0xc2, 0x16, 0xa0, 0xf7, 0x02, 0x72, 0x32, 0x26, 0xb0, 0xe0,
+    0x34, 0xfc, 0xe7, 0x97, 0x0f, 0xbf, 0x2e, 0x7c, 0xbf, 0x67, 0xc6, 0xb0, 0xb3, 0x40, 0xd2, 0xf0,
+    0x58, 0xeb, 0x98, 0xbc, 0xd4, 0x73, 0xd9, 0x2c, 0x44, 0x53, 0x6f, 0xc6, 0x65, 0x01, 0xd4, 0xd7,
+    0x06, 0x5f, 0xd9, 0x04, 0xf5, 0xb1, 0x8a, 0x73, 0x34, 0x65, 0x6c, 0xba, 0xc9, 0x28, 0x4a, 0x44,
+    0x56, 0xda, 0x78, 0x7d, 0xa9, 0xe7, 0xa5, 0x28, 0x3c, 0x3d, 0x7b, 0x7d, 0xaf, 0x36, 0x9f, 0x12,
+    0xce, 0x0f, 0xbf, 0x3d, 0x16, 0xce, 0x6b, 0x8e, 0x5c, 0xfc, 0x94, 0x78, 0xe6, 0xce, 0x60, 0x35,
+    0xa0, 0x8d, 0x3e, 0xbe, 0x2d, 0xb0, 0x92, 0x8c, 0x47, 0xae, 0xb1, 0xfd, 0x18, 0x59, 0x2e, 0xfc,
+    0x04, 0xa9, 0x51, 0x16, 0xdd, 0x07, 0x8f, 0xab, 0x97, 0x2b, 0x0c, 0x70, 0xf4, 0x19, 0xe9, 0x98,
+    0x4b, 0x47, 0x01, 0xb7, 0x20, 0xaf, 0xf4, 0xbc, 0x49, 0x82, 0x95, 0x43, 0x0d, 0xf8, 0xf3, 0x98,
+    0x1f, 0x76, 0x75, 0x86, 0x30, 0x1f, 0x3f, 0x7e, 0x57, 0xe5, 0xc3, 0x53, 0x12, 0x59, 0x45, 0x2e,
+    0xa2, 0x04, 0xe2, 0x42, 0x42, 0x95, 0xc4, 0x95, 0x66, 0xec, 0xed, 0xba, 0x66, 0x2c, 0x1b, 0x6a,
+    0xc6, 0xf3, 0x16, 0x63, 0xbe, 0x93, 0x4d, 0x31, 0xde, 0x5e, 0xf4, 0xa8, 0x1f, 0x50, 0xbc, 0xb0,
+    0xba, 0x0c, 0xc2, 0x54, 0x90, 0x38, 0x44, 0x0a, 0x65, 0x69, 0xd8, 0xed, 0x1c, 0x2c, 0xaa, 0x70,
+    0xaf, 0x79, 0x1b, 0xaa, 0xca, 0x72, 0xe1, 0x27, 0x68, 0x1d, 0x42, 0xbd, 0x25, 0x85, 0xb1, 0x74,
+    0x53, 0xdf, 0xe0, 0xdc, 0xb9, 0xcb, 0x1e, 0x2e, 0x56, 0x93, 0xb7, 0x48, 0xdc, 0xe7, 0xe4, 0x45,
+    0x1c, 0x2f, 0xe2, 0x6d, 0xa4, 0xaf, 0x91, 0xb7, 0xd4, 0x29, 0x33, 0x5d, 0xcf, 0x65, 0x07, 0xea,
+    0x45, 0xf5, 0xa4, 0x5e, 0xa3, 0xed, 0x3f, 0x79, 0xcf, 0x43, 0x87, 0x5d, 0xe7, 0xf4, 0x52, 0xa4,
+    0x88, 0x8f, 0xc2, 0x35, 0xd8, 0x42, 0x65, 0x85, 0x65, 0x6e, 0x78, 0x66, 0xce, 0xd2, 0xb3, 0x30,
+    0x2c, 0x0d, 0xca, 0xf7, 0xad, 0xa1, 0x57, 0x21, 0xf6, 0x36, 0xc3, 0x42, 0x58, 0xdc, 0x29, 0xfd,
+    0xf0, 0x52, 0xa7, 0x48, 0xd7, 0x56, 0xfc, 0x01, 0xf4, 0x17, 0xa9, 0xab, 0xc3, 0x1d, 0xbe, 0x01,
+    0x89, 0xf4, 0xb8, 0x03, 0x2d, 0xf7, 0x9d, 0xbe, 0xce, 0x1c, 0x6b, 0x88, 0x67, 0x7c, 0x40, 0x4f,
+    0xb1, 0xfb, 0x48, 0xeb, 0x54, 0x58, 0xe4, 0xd0, 0xf6, 0xb0, 0x53, 0x6e, 0xae, 0x68, 0x8d, 0x68,
+    0x38, 0x22, 0xad, 0x57, 0x3a, 0x4f, 0xb9, 0xdc, 0xac, 0x75, 0x42, 0xc3, 0x13, 0xd2, 0x3a, 0x06,
+    0x6e, 0x6c, 0x53, 0xa9, 0x53, 0xfa, 0xf2, 0x40, 0x44, 0x1b, 0x1b, 0x07, 0xab, 0xce, 0xbc, 0x0a,
+    0x71, 0x6f, 0x11, 0x57, 0x11, 0xb6, 0xf3, 0x5d, 0xe9, 0x23, 0xa9, 0x0d, 0x2c, 0x6a, 0x7f, 0xe8,
+    0xb7, 0x1b, 0x35, 0x7f, 0x08, 0xcb, 0xf0, 0x19, 0x34, 0x90, 0xdc, 0xb2, 0x66, 0x8d, 0xc3, 0xc2,
+    0x4f, 0x07, 0xac, 0x36, 0xdf, 0xc6, 0xfe, 0x5f, 0x43, 0x29, 0xd7, 0xe5, 0x8f, 0x33, 0x6a, 0xc4,
+    0x55, 0x81, 0x1e, 0x39, 0x52, 0x55, 0x64, 0xca, 0x96, 0xbf, 0x6f, 0x9b, 0xda, 0xb1, 0xfa, 0x64,
+    0x1e, 0xf8, 0x2f, 0xe6, 0x39, 0xc6, 0x40, 0x38, 0x71, 0xf7, 0x2c, 0xcc, 0xe3, 0xb0, 0x93, 0x2d,
+    0x1f, 0xe8, 0xc7, 0xcf, 0xc3, 0xc3, 0x29, 0x4a, 0x34, 0xde, 0xc6, 0x48, 0x33, 0xb9, 0x06, 0x54,
+    0xec, 0xfc, 0x6a, 0x3d, 0x3b, 0x7d, 0x86, 0x19, 0x39, 0xdd, 0x98, 0xd8, 0x26, 0x40, 0xba, 0x16,
+    0x60, 0xe4, 0x00, 0x46, 0xff, 0x09, 0x20, 0x59, 0x0b, 0x70, 0xe2, 0x00, 0x4e, 0x1e, 0x9c, 0x86,
+    0xcb, 0x4c, 0xaa, 0x93, 0x58, 0x65, 0xcb, 0x5d, 0xb2, 0x7a, 0x7b, 0x3e, 0x57, 0xff, 0x87, 0x62,
+    0x4b, 0xb3, 0xf9, 0xd0, 0x49, 0x1e, 0xe3, 0x86, 0x89, 0x72, 0x91, 0x59, 0x62, 0xf2, 0xa8, 0xbe,
+    0x68, 0xf6, 0x20, 0xfe, 0x8a, 0xe3, 0x7f, 0xfb, 0xca, 0xb8, 0xbb, 0x62, 0xa9, 0xe0, 0x0c, 0xaa,
+    0x9b, 0x66, 0xc7, 0x5f, 0xb5, 0xff, 0x05, 0x83, 0x42, 0x95, 0x6b, 0x7a, 0x0b, 0x00, 0x00,
+};
+static const WebAsset WEB_HOME_PAGE = {"/", "text/html", WEB_HOME_PAGE_GZ, sizeof(WEB_HOME_PAGE_GZ), "\"d240e9533495a018\"", false};
+
+// Versioned assets, registered by path
+static const WebAsset *const WEB_VERSIONED_ASSETS[] = {
+    &WEB_HOME_CSS,
+    &WEB_HOME_JS,
+};
+
+#endif // USER_WEB_ASSETS_H